@@ -0,0 +1,47 @@
+#ifndef BUFFER_HANDLE_CALENDAR_HPP
+#define BUFFER_HANDLE_CALENDAR_HPP
+
+#include <chrono> // system_clock time_point
+#include <cstdint> // int64_t uint8_t
+#include <ctime> // time_t timespec
+
+namespace buffer_handle
+{
+  struct calendar_t
+  {
+    int year;
+    uint8_t month;//1-12
+    uint8_t day;//1-31
+    uint8_t weekday;//0 is Sunday
+    uint8_t hours;
+    uint8_t minutes;
+    uint8_t seconds;
+  };
+
+  int64_t days_from_civil(int year, unsigned month, unsigned day);
+
+  void civil_from_days(int64_t days, int & year, unsigned & month, unsigned & day);
+
+  unsigned weekday_from_days(int64_t days);
+
+  unsigned days_in_month(int year, unsigned month);
+
+  time_t epoch_days(time_t value);
+
+  template<class Duration>
+  time_t epoch_seconds(const std::chrono::time_point<std::chrono::system_clock, Duration> & value);
+
+  template<class Duration>
+  timespec epoch_timespec(const std::chrono::time_point<std::chrono::system_clock, Duration> & value);
+
+  time_t epoch_seconds(const calendar_t & value);
+
+  calendar_t calendar(time_t value);
+
+  template<class Duration>
+  calendar_t calendar(const std::chrono::time_point<std::chrono::system_clock, Duration> & value);
+};
+
+#include <buffer_handle/calendar.hcp>
+
+#endif/*BUFFER_HANDLE_CALENDAR_HPP*/
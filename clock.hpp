@@ -0,0 +1,61 @@
+#ifndef BUFFER_HANDLE_CLOCK_HPP
+#define BUFFER_HANDLE_CLOCK_HPP
+
+#include <atomic> // atomic atomic_flag
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t
+#include <ctime> // time_t
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/config.hpp> // config
+#include <buffer_handle/seqlock.hpp> // seqlock_t
+
+namespace buffer_handle
+{
+  enum class clock_format : uint8_t
+  {
+    asc,
+      rfc822,
+      rfc850,
+      rfc1123,
+      rfc5322,
+      rfc7231,
+      iso8601
+      };
+
+  constexpr std::size_t clock_format_length(clock_format format);
+
+  class date_clock_t
+  {
+  public:
+    date_clock_t();
+
+    date_clock_t(const date_clock_t &) = delete;
+    date_clock_t & operator=(const date_clock_t &) = delete;
+
+  public:
+    bool tick(time_t now);
+
+    template<clock_format Format>
+    char * copy(char * buffer, time_t now);
+
+  protected:
+    static constexpr std::size_t size = 24 + 27 + 33 + 29 + 31 + 29 + 20;
+
+    seqlock_t lock;
+    std::atomic<time_t> second;
+    std::atomic_flag rendering;
+
+    std::atomic<time_t> rendered;
+    char texts[size];
+
+    char staging[size];//Only accessed while rendering
+  };
+
+  template<config Config, clock_format Format, action Action>
+  char * cached_date(char * buffer, date_clock_t & clock, time_t now);
+};
+
+#include <buffer_handle/clock.hcp>
+
+#endif/*BUFFER_HANDLE_CLOCK_HPP*/
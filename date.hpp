@@ -1,11 +1,14 @@
 #ifndef BUFFER_HANDLE_DATE_HPP
 #define BUFFER_HANDLE_DATE_HPP
 
-#include <ctime> // struct tm
+#include <chrono> // system_clock time_point
+#include <ctime> // time_t timespec tm
 
 #include <buffer_handle/action.hpp> // action
 #include <buffer_handle/align.hpp> // align
+#include <buffer_handle/calendar.hpp> // calendar_t
 #include <buffer_handle/config.hpp> // config
+#include <buffer_handle/precision.hpp> // precision
 
 namespace buffer_handle
 {
@@ -14,7 +17,7 @@ namespace buffer_handle
   char * day_month_year(char * buffer, Day day, Month month, Year year);
 
   template<config Config, action Action,
-	   typename Month, typename Day>
+	   typename Month, typename Day, char InsteadOfALeadingZeroForDay = '\0'>
   char * month_day(char * buffer, Month month, Day day);
 
   template<config Config, action Action, typename Weekday>
@@ -36,7 +39,17 @@ namespace buffer_handle
 		Hours hours, Minutes minutes, Seconds seconds);
 
     template<config Config, action Action>
-    char * date(char * buffer, std::tm date_time);
+    char * date(char * buffer, const std::tm & date_time);
+
+    template<config Config, action Action>
+    char * date(char * buffer, time_t value);
+
+    template<config Config, action Action, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value);
+
+    const char * parse(const char * begin, const char * end, calendar_t & value);
+
+    const char * parse(const char * begin, const char * end, time_t & value);
   };
 
   namespace rfc822//§5
@@ -50,7 +63,17 @@ namespace buffer_handle
 		const Timezone & timezone);
 
     template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone, action Action>
-    char * date(char * buffer, std::tm date_time, const Timezone & timezone);
+    char * date(char * buffer, const std::tm & date_time, const Timezone & timezone);
+
+    template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone, action Action>
+    char * date(char * buffer, time_t value, const Timezone & timezone);
+
+    template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone, action Action, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value, const Timezone & timezone);
+
+    const char * parse(const char * begin, const char * end, calendar_t & value, int & offset);
+
+    const char * parse(const char * begin, const char * end, time_t & value);
   };
 
   namespace rfc850//§2.1.4
@@ -64,7 +87,17 @@ namespace buffer_handle
 		const Timezone & timezone);
 
     template<config Config, class Timezone, action Action>
-    char * date(char * buffer, std::tm date_time, const Timezone & timezone);
+    char * date(char * buffer, const std::tm & date_time, const Timezone & timezone);
+
+    template<config Config, class Timezone, action Action>
+    char * date(char * buffer, time_t value, const Timezone & timezone);
+
+    template<config Config, class Timezone, action Action, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value, const Timezone & timezone);
+
+    const char * parse(const char * begin, const char * end, calendar_t & value, int & offset);
+
+    const char * parse(const char * begin, const char * end, time_t & value);
   };
 
   namespace rfc1123//§5.2.14
@@ -78,7 +111,17 @@ namespace buffer_handle
 		const Timezone & timezone);
 
     template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone, action Action>
-    char * date(char * buffer, std::tm date_time, const Timezone & timezone);
+    char * date(char * buffer, const std::tm & date_time, const Timezone & timezone);
+
+    template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone, action Action>
+    char * date(char * buffer, time_t value, const Timezone & timezone);
+
+    template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone, action Action, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value, const Timezone & timezone);
+
+    const char * parse(const char * begin, const char * end, calendar_t & value, int & offset);
+
+    const char * parse(const char * begin, const char * end, time_t & value);
   };
 
   namespace rfc5322//§3.3
@@ -93,8 +136,20 @@ namespace buffer_handle
 		bool timezone_sign, TimezoneHours timezone_hours, TimezoneMinutes timezone_minutes);
 
     template<config Config, action Action, typename TimezoneHours, typename TimezoneMinutes>
-    char * date(char * buffer, std::tm date_time,
+    char * date(char * buffer, const std::tm & date_time,
+		bool timezone_sign, TimezoneHours timezone_hours, TimezoneMinutes timezone_minutes);
+
+    template<config Config, action Action, typename TimezoneHours, typename TimezoneMinutes>
+    char * date(char * buffer, time_t value,
+		bool timezone_sign, TimezoneHours timezone_hours, TimezoneMinutes timezone_minutes);
+
+    template<config Config, action Action, typename TimezoneHours, typename TimezoneMinutes, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value,
 		bool timezone_sign, TimezoneHours timezone_hours, TimezoneMinutes timezone_minutes);
+
+    const char * parse(const char * begin, const char * end, calendar_t & value, int & offset);
+
+    const char * parse(const char * begin, const char * end, time_t & value);
   };
 
   namespace rfc7231//§7.1.1.1
@@ -107,8 +162,43 @@ namespace buffer_handle
 		Hours hours, Minutes minutes, Seconds seconds);
 
     template<config Config, action Action>
-    char * date(char * buffer, std::tm date_time);
+    char * date(char * buffer, const std::tm & date_time);
+
+    template<config Config, action Action>
+    char * date(char * buffer, time_t value);
+
+    template<config Config, action Action, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value);
+
+    const char * parse(const char * begin, const char * end, calendar_t & value);
+
+    const char * parse(const char * begin, const char * end, time_t & value);
   };
+
+  namespace iso8601//rfc3339 §5.6
+  {
+    template<config Config, precision Precision, class Timezone, action Action,
+	     typename Day, typename Month, typename Year,
+	     typename Hours, typename Minutes, typename Seconds, typename Fraction>
+    char * date(char * buffer,
+		Day day, Month month, Year year,
+		Hours hours, Minutes minutes, Seconds seconds, Fraction fraction,
+		const Timezone & timezone);
+
+    template<config Config, precision Precision, class Timezone, action Action>
+    char * date(char * buffer, const std::tm & date_time, const Timezone & timezone);
+
+    template<config Config, precision Precision, class Timezone, action Action>
+    char * date(char * buffer, time_t value, const Timezone & timezone);
+
+    template<config Config, precision Precision, class Timezone, action Action>
+    char * date(char * buffer, const timespec & value, const Timezone & timezone);
+
+    template<config Config, precision Precision, class Timezone, action Action, class Duration>
+    char * date(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & value, const Timezone & timezone);
+  };
+
+  namespace rfc3339 = iso8601;
 };
 
 #include <buffer_handle/date.hcp>
@@ -0,0 +1,165 @@
+#ifndef BUFFER_HANDLE_DATE_TIME_HPP
+#define BUFFER_HANDLE_DATE_TIME_HPP
+
+#include <cstddef> // size_t
+#include <ctime> // time_t
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/config.hpp> // config
+
+namespace buffer_handle
+{
+  template<class Format, config Config>
+  struct date_time_t
+  {
+  public:
+    date_time_t(const Format & format = Format());
+
+  public:
+    Format format;
+
+  protected:
+    bool is_written;
+    time_t last;
+
+  public:
+    template<action Action>
+    char * handle(char * buffer, time_t value);
+  };
+
+  namespace asc
+  {
+    struct format_t
+    {
+      static constexpr bool handle_seconds = true;
+      static constexpr std::size_t time_offset = 3 + 1 + 6 + 1;
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config>
+    using date_time_t = ::buffer_handle::date_time_t<format_t, Config>;
+  };
+
+  namespace rfc822
+  {
+    template<bool HandleWeekday, bool HandleSeconds, class Timezone>
+    struct format_t
+    {
+      format_t(const Timezone & timezone = Timezone());
+
+      Timezone timezone;
+
+      static constexpr bool handle_seconds = HandleSeconds;
+      static constexpr std::size_t time_offset = 5 * HandleWeekday + 9 + 1;
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone>
+    using date_time_t = ::buffer_handle::date_time_t<format_t<HandleWeekday, HandleSeconds, Timezone>, Config>;
+  };
+
+  namespace rfc850
+  {
+    template<class Timezone>
+    struct format_t
+    {
+      format_t(const Timezone & timezone = Timezone());
+
+      Timezone timezone;
+
+      static constexpr bool handle_seconds = true;
+      static constexpr std::size_t time_offset = 9 + 2 + 9 + 1;//Dynamic weekday
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config, class Timezone>
+    using date_time_t = ::buffer_handle::date_time_t<format_t<Timezone>, Config>;
+  };
+
+  namespace rfc1123
+  {
+    template<bool HandleWeekday, bool HandleSeconds, class Timezone>
+    struct format_t
+    {
+      format_t(const Timezone & timezone = Timezone());
+
+      Timezone timezone;
+
+      static constexpr bool handle_seconds = HandleSeconds;
+      static constexpr std::size_t time_offset = 5 * HandleWeekday + 11 + 1;
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config, bool HandleWeekday, bool HandleSeconds, class Timezone>
+    using date_time_t = ::buffer_handle::date_time_t<format_t<HandleWeekday, HandleSeconds, Timezone>, Config>;
+  };
+
+  namespace rfc5322
+  {
+    template<typename TimezoneHours, typename TimezoneMinutes>
+    struct format_t
+    {
+      format_t(bool timezone_sign = true, TimezoneHours timezone_hours = 0, TimezoneMinutes timezone_minutes = 0);
+
+      bool timezone_sign;
+      TimezoneHours timezone_hours;
+      TimezoneMinutes timezone_minutes;
+
+      static constexpr bool handle_seconds = true;
+      static constexpr std::size_t time_offset = 5 + 11 + 1;
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config, typename TimezoneHours = int, typename TimezoneMinutes = int>
+    using date_time_t = ::buffer_handle::date_time_t<format_t<TimezoneHours, TimezoneMinutes>, Config>;
+  };
+
+  namespace rfc7231
+  {
+    struct format_t
+    {
+      static constexpr bool handle_seconds = true;
+      static constexpr std::size_t time_offset = 5 + 11 + 1;
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config>
+    using date_time_t = ::buffer_handle::date_time_t<format_t, Config>;
+  };
+
+  namespace iso8601
+  {
+    template<class Timezone>
+    struct format_t
+    {
+      format_t(const Timezone & timezone = Timezone());
+
+      Timezone timezone;
+
+      static constexpr bool handle_seconds = true;
+      static constexpr std::size_t time_offset = 10 + 1;
+
+      template<config Config, action Action>
+      char * handle(char * buffer, time_t value) const;
+    };
+
+    template<config Config, class Timezone>
+    using date_time_t = ::buffer_handle::date_time_t<format_t<Timezone>, Config>;
+  };
+};
+
+#include <buffer_handle/date_time.hcp>
+
+#endif/*BUFFER_HANDLE_DATE_TIME_HPP*/
@@ -0,0 +1,47 @@
+#ifndef BUFFER_HANDLE_DURATION_HPP
+#define BUFFER_HANDLE_DURATION_HPP
+
+#include <chrono> // duration
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t uint64_t
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/config.hpp> // config
+#include <buffer_handle/precision.hpp> // precision
+
+namespace buffer_handle
+{
+  enum class duration_format : uint8_t
+  {
+    clock,//Dd HH:MM:SS.fff
+      unit//123.456 ms
+      };
+
+  template<config Config, duration_format Format, std::size_t Digits, precision Precision, action Action>
+  char * duration(char * buffer, uint64_t nanoseconds);
+
+  template<config Config, duration_format Format, std::size_t Digits, precision Precision, action Action, class Rep, class Period>
+  char * duration(char * buffer, const std::chrono::duration<Rep, Period> & value);
+
+  template<config Config, duration_format Format, std::size_t Digits, precision Precision>
+  struct duration_t
+  {
+  public:
+    duration_t();
+
+  protected:
+    bool is_written;
+    uint64_t last;
+
+  public:
+    template<action Action>
+    char * handle(char * buffer, uint64_t nanoseconds);
+
+    template<action Action, class Rep, class Period>
+    char * handle(char * buffer, const std::chrono::duration<Rep, Period> & value);
+  };
+};
+
+#include <buffer_handle/duration.hcp>
+
+#endif/*BUFFER_HANDLE_DURATION_HPP*/
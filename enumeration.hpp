@@ -0,0 +1,26 @@
+#ifndef BUFFER_HANDLE_ENUMERATION_HPP
+#define BUFFER_HANDLE_ENUMERATION_HPP
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/align.hpp> // align
+#include <buffer_handle/config.hpp> // config
+
+namespace buffer_handle
+{
+  template<class Enumeration, action Action>
+  char * enumeration(char * buffer, typename Enumeration::value_type value);
+
+  template<config Config, align Align, char Pad, class Enumeration, action Action>
+  char * enumeration(char * buffer, typename Enumeration::value_type value);
+
+  template<config Config, align Align, char Pad, class Enumeration>
+  struct enumeration_t
+  {
+    template<action Action>
+    char * handle(char * buffer, typename Enumeration::value_type value);
+  };
+};
+
+#include <buffer_handle/enumeration.hcp>
+
+#endif/*BUFFER_HANDLE_ENUMERATION_HPP*/
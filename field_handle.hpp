@@ -0,0 +1,86 @@
+#ifndef BUFFER_HANDLE_FIELD_HANDLE_HPP
+#define BUFFER_HANDLE_FIELD_HANDLE_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint16_t uint32_t
+
+#include <sys/uio.h> // iovec
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/align.hpp> // align
+
+namespace buffer_handle
+{
+  struct field_handle_t
+  {
+  public:
+    uint32_t offset;
+    uint16_t width;
+    align alignment;
+    char pad;
+
+  public:
+    char * write(char * buffer, const char * value, std::size_t length) const;
+
+    char * write(char * buffer, const char * value) const;
+
+    template<class Itoa, typename I>
+    char * write(char * buffer, I value, const Itoa & itoa = Itoa()) const;
+
+    char * reset(char * buffer) const;
+  };
+
+  template<std::size_t N>
+  struct field_handles_t
+  {
+  public:
+    field_handles_t(const char * base = nullptr);
+
+  protected:
+    const char * base;
+    std::size_t count;
+    field_handle_t handles[N];
+
+  public:
+    template<action Action, align Align = align::left, char Pad = ' '>
+    char * record(char * begin, char * end);
+
+    std::size_t size() const;
+
+    const field_handle_t & operator[](std::size_t i) const;
+  };
+
+  template<std::size_t N>
+  class field_extents_t
+  {
+  public:
+    field_extents_t(const field_handles_t<N> & handles);
+
+  protected:
+    const field_handles_t<N> * handles;
+    std::size_t lengths[N];//Content length of each field, padding excluded
+
+  public:
+    std::size_t & length(std::size_t i);//Usable as a previous_length
+    std::size_t length(std::size_t i) const;
+
+    char * write(char * buffer, std::size_t i, const char * value, std::size_t length);
+
+    char * write(char * buffer, std::size_t i, const char * value);
+
+    template<class Itoa, typename I>
+    char * write(char * buffer, std::size_t i, I value, const Itoa & itoa = Itoa());
+
+    char * reset(char * buffer, std::size_t i);
+
+    std::size_t compact_size(std::size_t size) const;
+
+    char * compact(char * destination, const char * buffer, std::size_t size) const;
+
+    iovec * compact(iovec * iov, const char * buffer, std::size_t size) const;
+  };
+};
+
+#include <buffer_handle/field_handle.hcp>
+
+#endif/*BUFFER_HANDLE_FIELD_HANDLE_HPP*/
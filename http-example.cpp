@@ -3,7 +3,7 @@
 
 #include <buffer_handle/number.hpp> // number()
 #include <buffer_handle/string.hpp> // string()
-#include <buffer_handle/token.hpp> // carriage_return(), new_line(), space()
+#include <buffer_handle/token.hpp> // space(), tokens()
 
 #include <buffer_handle/adapter/itoa/to_string.hpp> // to_string_t
 
@@ -26,23 +26,20 @@ char * handle(char * buffer, unsigned short code, const char * reason,
   buffer = string<Config, align::left, ' ', Action>
     (buffer, reason, std::strlen(reason), reason_max_length);
 
-  buffer = carriage_return<config::static_, Action>(buffer);
-  buffer = new_line<config::static_, Action>(buffer);
+  buffer = tokens<config::static_, Action, '\r', '\n'>(buffer);
 
   buffer = string<config::static_, Action>(buffer, "Content-Length: ");
   buffer = integral_number<Config, align::right, ' ', Action, adapter::itoa::to_string_t>
     (buffer, length, max_length_digits);
 
-  buffer = carriage_return<config::static_, Action>(buffer);
-  buffer = new_line<config::static_, Action>(buffer);
+  buffer = tokens<config::static_, Action, '\r', '\n'>(buffer);
 
   buffer = string<config::static_, Action>(buffer, "Content-Type: ");
   buffer = string<Config, align::right, ' ', Action>
     (buffer, type, std::strlen(type), type_max_length);
   buffer = string<config::static_, Action>(buffer, "; charset=UTF-8");
 
-  buffer = carriage_return<config::static_, Action>(buffer);
-  buffer = new_line<config::static_, Action>(buffer);
+  buffer = tokens<config::static_, Action, '\r', '\n'>(buffer);
 
   buffer = string<config::static_, Action>(buffer, "Content-Encoding: ");
   buffer = string<Config, align::right, ' ', Action>
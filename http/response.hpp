@@ -0,0 +1,73 @@
+#ifndef BUFFER_HANDLE_HTTP_RESPONSE_HPP
+#define BUFFER_HANDLE_HTTP_RESPONSE_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+#include <ctime> // time_t
+#include <vector> // vector
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/clock.hpp> // date_clock_t
+
+namespace buffer_handle
+{
+  namespace http
+  {
+    constexpr const char * reason(unsigned short status);//Empty when unknown
+
+    constexpr std::size_t max_reason_length();
+
+    struct header_t
+    {
+      const char * name;
+      const char * value;
+    };
+
+    struct headers_t
+    {
+    public:
+      headers_t();
+
+    public:
+      date_clock_t * clock;//Date, when not null
+      std::size_t length_digits;//Content-Length, when not 0
+      const char * content_type;//Omitted when null
+      const char * connection;//Omitted when null
+      const char * cache_control;//Omitted when null
+      std::vector<header_t> custom;
+    };
+
+    class response_t
+    {
+    public:
+      response_t(const headers_t & headers);
+      response_t(const headers_t && headers) = delete;//Would dangle
+
+    protected:
+      const headers_t * headers;
+
+      uint32_t size;
+      uint32_t status_offset;
+      uint32_t date_offset;
+      uint32_t length_offset;
+
+      std::size_t reason_length;
+      std::size_t length_length;
+
+    public:
+      template<action Action>
+      char * handle(char * buffer, unsigned short status, std::size_t length, time_t now);
+
+    protected:
+      template<action Action>
+      char * walk(char * buffer, time_t now);
+
+      void write(char * buffer, unsigned short status, std::size_t length, time_t now);
+      void reset(char * buffer);
+    };
+  };
+};
+
+#include <buffer_handle/http/response.hcp>
+
+#endif/*BUFFER_HANDLE_HTTP_RESPONSE_HPP*/
@@ -0,0 +1,150 @@
+#ifndef BUFFER_HANDLE_LAYOUT_HPP
+#define BUFFER_HANDLE_LAYOUT_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t uint64_t
+
+#include <sys/uio.h> // iovec
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/align.hpp> // align
+
+namespace buffer_handle
+{
+  namespace details
+  {
+    constexpr std::size_t text_length(const char * text)
+    {
+      return *text == '\0' ? 0 : 1 + text_length(text + 1);
+    }
+
+    template<std::size_t I, std::size_t Offset, class... Fields>
+    struct layout_at;
+
+    template<std::size_t Offset, class... Fields>
+    struct layout_fields;
+
+    enum class layout_segment : uint8_t
+    {
+      none,
+	image,
+	dynamic
+	};
+
+    template<std::size_t I, std::size_t ImageOffset, std::size_t DynamicOffset, class... Fields>
+    struct layout_split_at;
+
+    template<layout_segment Previous, std::size_t ImageOffset, std::size_t DynamicOffset, class... Fields>
+    struct layout_split;
+  };
+
+  template<char... C>
+  struct characters_field_t
+  {
+    static constexpr std::size_t width = sizeof...(C);
+    static constexpr bool is_dynamic = false;
+
+    template<action Action>
+    static char * handle(char * buffer);
+  };
+
+  template<class Text>
+  struct text_field_t
+  {
+    static constexpr std::size_t width = details::text_length(Text::value());
+    static constexpr bool is_dynamic = false;
+
+    template<action Action>
+    static char * handle(char * buffer);
+  };
+
+  template<std::size_t Width, align Align = align::left, char Pad = ' '>
+  struct string_field_t
+  {
+    typedef const char * value_type;
+
+    static constexpr std::size_t width = Width;
+    static constexpr bool is_dynamic = true;
+
+    template<action Action>
+    static char * handle(char * buffer);
+
+    static char * write(char * buffer, value_type value);
+  };
+
+  template<std::size_t Digits, typename I = uint64_t>
+  struct digits_field_t
+  {
+    typedef I value_type;
+
+    static constexpr std::size_t width = Digits;
+    static constexpr bool is_dynamic = true;
+
+    template<action Action>
+    static char * handle(char * buffer);
+
+    static char * write(char * buffer, value_type value);
+  };
+
+  template<std::size_t Digits, align Align, char Pad, class Itoa, typename I = uint64_t>
+  struct integral_field_t
+  {
+    typedef I value_type;
+
+    static constexpr std::size_t width = Digits;
+    static constexpr bool is_dynamic = true;
+
+    template<action Action>
+    static char * handle(char * buffer);
+
+    static char * write(char * buffer, value_type value);
+  };
+
+  template<class... Fields>
+  struct layout_t
+  {
+    static constexpr std::size_t size = details::layout_fields<0, Fields...>::size;
+    static constexpr std::size_t count = sizeof...(Fields);
+
+    template<std::size_t I>
+    using field = typename details::layout_at<I, 0, Fields...>::type;
+
+    template<std::size_t I>
+    static constexpr std::size_t offset();
+
+    template<action Action>
+    static char * handle(char * buffer);
+
+    template<std::size_t I>
+    static char * write(char * buffer, const typename field<I>::value_type & value);
+
+    template<class... Values>
+    static char * write(char * buffer, const Values &... values);
+
+    //Static fields in a shared image, dynamic fields in a compact buffer
+    static constexpr std::size_t image_size = details::layout_split<details::layout_segment::none, 0, 0, Fields...>::image_size;
+    static constexpr std::size_t dynamic_size = details::layout_split<details::layout_segment::none, 0, 0, Fields...>::dynamic_size;
+    static constexpr std::size_t segments = details::layout_split<details::layout_segment::none, 0, 0, Fields...>::segments;
+
+    template<std::size_t I>
+    static constexpr std::size_t split_offset();
+
+    template<action Action>
+    static char * handle_image(char * image);
+
+    template<action Action>
+    static char * handle_dynamic(char * buffer);
+
+    template<std::size_t I>
+    static char * write_dynamic(char * buffer, const typename field<I>::value_type & value);
+
+    template<class... Values>
+    static char * write_dynamic(char * buffer, const Values &... values);
+
+    static iovec * gather(iovec * iov, const char * image, const char * buffer);
+  };
+};
+
+#include <buffer_handle/layout.hcp>
+
+#endif/*BUFFER_HANDLE_LAYOUT_HPP*/
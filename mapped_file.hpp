@@ -0,0 +1,48 @@
+#ifndef BUFFER_HANDLE_MAPPED_FILE_HPP
+#define BUFFER_HANDLE_MAPPED_FILE_HPP
+
+#include <cstddef> // size_t
+
+#include <buffer_handle/action.hpp> // action
+
+namespace buffer_handle
+{
+  class mapped_file_t
+  {
+  public:
+    explicit mapped_file_t(std::size_t batch = 0);
+    ~mapped_file_t();
+
+    mapped_file_t(const mapped_file_t &) = delete;
+    mapped_file_t & operator=(const mapped_file_t &) = delete;
+
+  protected:
+    char * buffer;
+    std::size_t length;
+
+    std::size_t batch;
+    std::size_t pending;
+
+  public:
+    bool open(const char * path, std::size_t size);
+
+    template<class Handler, class... Args>
+    bool open(const char * path, Handler & handler, const Args &... args);
+
+    void close();
+
+    bool is_open() const;
+
+    char * data() const;
+    std::size_t size() const;
+
+    template<action Action, class Handler, class... Args>
+    char * handle(Handler & handler, const Args &... args);
+
+    bool sync(bool wait = false);
+  };
+};
+
+#include <buffer_handle/mapped_file.hcp>
+
+#endif/*BUFFER_HANDLE_MAPPED_FILE_HPP*/
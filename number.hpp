@@ -1,6 +1,7 @@
 #ifndef BUFFER_HANDLE_NUMBER_HPP
 #define BUFFER_HANDLE_NUMBER_HPP
 
+#include <cstddef> // size_t
 #include <cstdint> // uint8_t
 
 #include <buffer_handle/action.hpp> // action
@@ -15,6 +16,9 @@ namespace buffer_handle
   template<config Config, action Action, typename I>
   char * four_digits_number(char * buffer, I i);
 
+  template<config Config, std::size_t Digits, action Action, typename I>
+  char * digits_number(char * buffer, I i);
+
   template<action Action, class Itoa, typename I>
   char * integral_number(char * buffer, I i, const Itoa & itoa = Itoa());
 
@@ -0,0 +1,92 @@
+#ifndef BUFFER_HANDLE_POOL_HPP
+#define BUFFER_HANDLE_POOL_HPP
+
+#include <atomic> // atomic
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t uint64_t
+
+#include <buffer_handle/prototype.hpp> // prototype_t
+
+namespace buffer_handle
+{
+  template<class Handler>
+  struct alignas(64) pool_entry_t//One cache line at least, no false sharing between entries
+  {
+    Handler handler;
+    char * buffer;
+    std::atomic<uint32_t> next;
+  };
+
+  template<class Handler, std::size_t Magazine>
+  class pool_cache_t;
+
+  template<class Handler>
+  class pool_t
+  {
+    template<class, std::size_t>
+    friend class pool_cache_t;
+
+  public:
+    typedef pool_entry_t<Handler> entry_t;
+
+  public:
+    pool_t(const prototype_t<Handler> & prototype, std::size_t capacity);
+    ~pool_t();
+
+    pool_t(const pool_t &) = delete;
+    pool_t & operator=(const pool_t &) = delete;
+
+  protected:
+    const prototype_t<Handler> prototype;
+    const std::size_t stride;
+    const std::size_t count;
+    char * buffers;//Cache line aligned
+    entry_t * entries;//Cache line aligned
+    std::atomic<uint64_t> head;//Tag on the 32 upper bits, index on the 32 lower ones
+
+  public:
+    std::size_t capacity() const;
+    std::size_t buffer_size() const;
+
+    entry_t * entry(std::size_t index) const;
+    std::size_t index_of(const entry_t * entry) const;
+
+    entry_t * acquire();
+    void release(entry_t * entry);
+
+    template<class Iterator>
+    Iterator acquire(Iterator begin, Iterator end);
+
+  protected:
+    entry_t * pop();
+    void push(entry_t * entry);
+    void push(entry_t * const * begin, entry_t * const * end);
+  };
+
+  template<class Handler, std::size_t Magazine = 32>
+  class pool_cache_t
+  {
+  public:
+    typedef pool_entry_t<Handler> entry_t;
+
+  public:
+    pool_cache_t(pool_t<Handler> & pool);
+    ~pool_cache_t();
+
+    pool_cache_t(const pool_cache_t &) = delete;
+    pool_cache_t & operator=(const pool_cache_t &) = delete;
+
+  protected:
+    pool_t<Handler> & pool;
+    std::size_t count;
+    entry_t * entries[Magazine];
+
+  public:
+    entry_t * acquire();
+    void release(entry_t * entry);
+  };
+};
+
+#include <buffer_handle/pool.hcp>
+
+#endif/*BUFFER_HANDLE_POOL_HPP*/
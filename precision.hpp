@@ -0,0 +1,21 @@
+#ifndef BUFFER_HANDLE_PRECISION_HPP
+#define BUFFER_HANDLE_PRECISION_HPP
+
+#include <cstdint> // uint8_t
+
+namespace buffer_handle
+{
+  enum class precision : uint8_t
+  {
+    seconds = 0,
+      milliseconds = 3,
+      microseconds = 6,
+      nanoseconds = 9
+      };
+
+  constexpr long precision_scale(precision value);
+};
+
+#include <buffer_handle/precision.hcp>
+
+#endif/*BUFFER_HANDLE_PRECISION_HPP*/
@@ -0,0 +1,35 @@
+#ifndef BUFFER_HANDLE_PROTOTYPE_HPP
+#define BUFFER_HANDLE_PROTOTYPE_HPP
+
+#include <cstddef> // size_t
+#include <vector> // vector
+
+namespace buffer_handle
+{
+  template<class Handler>
+  class prototype_t
+  {
+  public:
+    template<class... Args>
+    prototype_t(const Handler & handler, const Args &... args);
+
+  public:
+    Handler handler;
+
+  protected:
+    std::vector<char> image;
+
+  public:
+    std::size_t size() const;
+
+    const char * data() const;
+
+    char * clone(char * buffer) const;
+
+    char * clone(char * buffer, Handler & handler) const;
+  };
+};
+
+#include <buffer_handle/prototype.hcp>
+
+#endif/*BUFFER_HANDLE_PROTOTYPE_HPP*/
@@ -0,0 +1,40 @@
+#ifndef BUFFER_HANDLE_PUBLISHED_HPP
+#define BUFFER_HANDLE_PUBLISHED_HPP
+
+#include <cstddef> // size_t
+
+#include <buffer_handle/seqlock.hpp> // seqlock_t
+
+namespace buffer_handle
+{
+  class published_t
+  {
+  public:
+    published_t(char * buffer, std::size_t size);
+
+    published_t(const published_t &) = delete;
+    published_t & operator=(const published_t &) = delete;
+
+  protected:
+    seqlock_t lock;
+    char * buffer;
+    std::size_t length;
+
+  public:
+    std::size_t size() const;
+
+    //Single writer
+    char * begin_write();
+    void end_write();
+
+    template<class Handler, class... Args>
+    char * write(Handler & handler, const Args &... args);
+
+    //Any number of readers
+    char * read(char * destination) const;
+  };
+};
+
+#include <buffer_handle/published.hcp>
+
+#endif/*BUFFER_HANDLE_PUBLISHED_HPP*/
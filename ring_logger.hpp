@@ -0,0 +1,74 @@
+#ifndef BUFFER_HANDLE_RING_LOGGER_HPP
+#define BUFFER_HANDLE_RING_LOGGER_HPP
+
+#include <atomic> // atomic
+#include <chrono> // microseconds
+#include <cstddef> // size_t
+#include <memory> // unique_ptr
+#include <thread> // thread
+#include <vector> // vector
+
+#include <buffer_handle/prototype.hpp> // prototype_t
+
+namespace buffer_handle
+{
+  template<class Handler>
+  struct ring_slot_t
+  {
+    Handler handler;
+    char * buffer;
+    std::atomic<bool> ready;
+  };
+
+  template<class Handler, bool MultiProducer = false>
+  class ring_logger_t
+  {
+  public:
+    typedef ring_slot_t<Handler> slot_t;
+
+  public:
+    ring_logger_t(const prototype_t<Handler> & prototype, std::size_t capacity, int fd);
+    ~ring_logger_t();
+
+    ring_logger_t(const ring_logger_t &) = delete;
+    ring_logger_t & operator=(const ring_logger_t &) = delete;
+
+  protected:
+    const std::size_t record_size;
+    const std::size_t slots_count;
+    const int fd;
+
+    std::vector<char> buffers;//Contiguous records, so that a run of slots is a single block
+    std::unique_ptr<slot_t[]> slots;
+
+    std::atomic<std::size_t> head;//Next slot to flush
+    std::atomic<std::size_t> tail;//Next slot to claim
+
+    std::atomic<bool> running;
+    std::thread flusher;
+
+    std::atomic<std::size_t> failures;
+
+  public:
+    std::size_t capacity() const;
+
+    //Producers
+    slot_t * claim();
+    void commit(slot_t * slot);
+
+    template<class... Args>
+    bool log(const Args &... args);
+
+    //Consumer
+    std::size_t flush();
+
+    void start(std::chrono::microseconds idle = std::chrono::microseconds(100));
+    void stop();
+
+    std::size_t errors() const;
+  };
+};
+
+#include <buffer_handle/ring_logger.hcp>
+
+#endif/*BUFFER_HANDLE_RING_LOGGER_HPP*/
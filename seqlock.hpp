@@ -0,0 +1,28 @@
+#ifndef BUFFER_HANDLE_SEQLOCK_HPP
+#define BUFFER_HANDLE_SEQLOCK_HPP
+
+#include <atomic> // atomic
+#include <cstddef> // size_t
+
+namespace buffer_handle
+{
+  struct seqlock_t
+  {
+  public:
+    seqlock_t();
+
+  protected:
+    std::atomic<std::size_t> sequence;
+
+  public:
+    void begin_write();
+    void end_write();
+
+    std::size_t begin_read() const;
+    bool retry_read(std::size_t sequence) const;
+  };
+};
+
+#include <buffer_handle/seqlock.hcp>
+
+#endif/*BUFFER_HANDLE_SEQLOCK_HPP*/
@@ -0,0 +1,37 @@
+#ifndef BUFFER_HANDLE_SWAR_HPP
+#define BUFFER_HANDLE_SWAR_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint16_t uint32_t uint64_t
+
+namespace buffer_handle
+{
+  namespace swar
+  {
+    // Encode zero padded ASCII digits in memory order
+    uint16_t encode_2_digits(uint32_t value);
+    uint32_t encode_4_digits(uint32_t value);
+    uint64_t encode_8_digits(uint32_t value);
+    uint64_t encode_time(uint32_t hours, uint32_t minutes, uint32_t seconds);//HH:MM:SS
+
+    char * write_2_digits(char * buffer, uint32_t value);
+    char * write_4_digits(char * buffer, uint32_t value);
+    char * write_6_digits(char * buffer, uint32_t value);
+    char * write_8_digits(char * buffer, uint32_t value);
+    char * write_16_digits(char * buffer, uint64_t value);
+    char * write_time(char * buffer, uint32_t hours, uint32_t minutes, uint32_t seconds);
+
+    template<std::size_t Digits>
+    char * write_digits(char * buffer, uint64_t value);
+
+    // Read ASCII digits, return false if any is not a digit
+    bool parse_2_digits(const char * buffer, uint32_t & value);
+    bool parse_4_digits(const char * buffer, uint32_t & value);
+    bool parse_8_digits(const char * buffer, uint32_t & value);
+    bool parse_time(const char * buffer, uint32_t & hours, uint32_t & minutes, uint32_t & seconds);//HH:MM:SS
+  };
+};
+
+#include <buffer_handle/swar.hcp>
+
+#endif/*BUFFER_HANDLE_SWAR_HPP*/
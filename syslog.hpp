@@ -0,0 +1,99 @@
+#ifndef BUFFER_HANDLE_SYSLOG_HPP
+#define BUFFER_HANDLE_SYSLOG_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t
+#include <ctime> // time_t timespec
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/config.hpp> // config
+#include <buffer_handle/precision.hpp> // precision
+
+namespace buffer_handle
+{
+  enum class facility : uint8_t
+  {
+    kern, user, mail, daemon,
+      auth, syslog, lpr, news,
+      uucp, cron, authpriv, ftp,
+      ntp, security, console, solaris_cron,
+      local0, local1, local2, local3,
+      local4, local5, local6, local7
+      };
+
+  enum class severity : uint8_t
+  {
+    emergency, alert, critical, error,
+      warning, notice, informational, debug
+      };
+
+  template<config Config, action Action>
+  char * priority(char * buffer, enum facility facility, enum severity severity);
+
+  std::size_t priority_offset(enum facility facility, enum severity severity);
+
+  namespace rfc5424
+  {
+    template<config Config, precision Precision>
+    struct header_t
+    {
+    public:
+      static constexpr std::size_t procid_max_length = 128;
+      static constexpr std::size_t msgid_max_length = 32;
+
+    public:
+      header_t(const char * hostname, const char * app_name);
+
+    public:
+      const char * hostname;
+      const char * app_name;
+
+    protected:
+      std::size_t hostname_length;
+      std::size_t app_name_length;
+      std::size_t slack;//Unused identifier length, the header starts after it
+      std::size_t offset;
+
+    public:
+      template<action Action>
+      char * handle(char * buffer,
+		    enum facility facility, enum severity severity, const timespec & time,
+		    const char * procid, const char * msgid);
+
+      char * begin(char * buffer) const;
+
+    protected:
+      template<action Action>
+      char * prefix(char * buffer, enum facility facility, enum severity severity, const timespec & time);
+    };
+  };
+
+  namespace rfc3164
+  {
+    template<config Config>
+    struct header_t
+    {
+    public:
+      header_t(const char * hostname, const char * tag);
+
+    public:
+      const char * hostname;
+      const char * tag;
+
+    protected:
+      std::size_t hostname_length;
+      std::size_t tag_length;
+      std::size_t offset;
+
+    public:
+      template<action Action>
+      char * handle(char * buffer, enum facility facility, enum severity severity, time_t time);
+
+      char * begin(char * buffer) const;
+    };
+  };
+};
+
+#include <buffer_handle/syslog.hcp>
+
+#endif/*BUFFER_HANDLE_SYSLOG_HPP*/
@@ -0,0 +1,58 @@
+#ifndef BUFFER_HANDLE_TABLE_HPP
+#define BUFFER_HANDLE_TABLE_HPP
+
+#include <cstddef> // size_t
+#include <type_traits> // enable_if is_integral
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/align.hpp> // align
+
+namespace buffer_handle
+{
+  template<std::size_t Width, align Align = align::left>
+  struct column_t
+  {
+    static constexpr std::size_t width = Width;
+    static constexpr align alignment = Align;
+  };
+
+  namespace details
+  {
+    template<class... Columns>
+    constexpr std::size_t table_row_length();
+  };
+
+  template<char Separator, char Pad, char Rule, class... Columns>
+  struct table_t
+  {
+  public:
+    static constexpr std::size_t columns = sizeof...(Columns);
+    static constexpr std::size_t row_length = details::table_row_length<Columns...>();
+
+  public:
+    table_t(std::size_t rows = 0);
+
+  public:
+    std::size_t rows;
+
+  protected:
+    bool has_header;
+
+  public:
+    template<action Action>
+    char * handle(char * buffer, const char * const * headers);
+
+    char * cell(char * buffer, std::size_t row, std::size_t column) const;
+
+    template<action Action>
+    char * cell(char * buffer, std::size_t row, std::size_t column, const char * value, std::size_t length);
+
+    template<action Action, class Itoa, typename I>
+    typename std::enable_if<std::is_integral<I>::value, char *>::type
+    cell(char * buffer, std::size_t row, std::size_t column, I value, const Itoa & itoa = Itoa());
+  };
+};
+
+#include <buffer_handle/table.hcp>
+
+#endif/*BUFFER_HANDLE_TABLE_HPP*/
@@ -4,20 +4,47 @@
 
 #include <boost/config.hpp>
 
+#include <fstream>
+#include <thread>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <buffer_handle/bitset.hpp>
 #include <buffer_handle/boolean.hpp>
+#include <buffer_handle/calendar.hpp>
 #include <buffer_handle/character.hpp>
+#include <buffer_handle/clock.hpp>
 #include <buffer_handle/container.hpp>
 #include <buffer_handle/date.hpp>
+#include <buffer_handle/date_time.hpp>
+#include <buffer_handle/duration.hpp>
+#include <buffer_handle/enumeration.hpp>
+#include <buffer_handle/field_handle.hpp>
+#include <buffer_handle/layout.hpp>
+#include <buffer_handle/mapped_file.hpp>
 #include <buffer_handle/nothing.hpp>
 #include <buffer_handle/number.hpp>
+#include <buffer_handle/pool.hpp>
+#include <buffer_handle/precision.hpp>
+#include <buffer_handle/prototype.hpp>
+#include <buffer_handle/published.hpp>
+#include <buffer_handle/ring_logger.hpp>
 #include <buffer_handle/string.hpp>
+#include <buffer_handle/swar.hpp>
+#include <buffer_handle/syslog.hpp>
+#include <buffer_handle/table.hpp>
 #include <buffer_handle/time.hpp>
 #include <buffer_handle/timezone.hpp>
 #include <buffer_handle/token.hpp>
+#include <buffer_handle/uring_sink.hpp>
+#include <buffer_handle/zoneinfo.hpp>
 
 #include <buffer_handle/helper.hpp>
 
+#include <buffer_handle/http/response.hpp>
+
 #include <buffer_handle/adapter/itoa/to_string.hpp>
 
 #include <buffer_handle/test.hpp>
@@ -183,6 +210,117 @@ SCENARIO("Boolean", "[boolean]")
     }
 }
 
+SCENARIO("Calendar", "[calendar]")
+{
+  FOR("A timestamp")
+    {
+      THEN("It matches gmtime_r")
+	{
+	  for(time_t value = -5000000000; value < 5000000000; value += 7777777)
+	    {
+	      std::tm expected;
+	      gmtime_r(&value, &expected);
+
+	      const calendar_t date_time = calendar(value);
+
+	      REQUIRE(date_time.year == expected.tm_year + 1900);
+	      REQUIRE(date_time.month == expected.tm_mon + 1);
+	      REQUIRE(date_time.day == expected.tm_mday);
+	      REQUIRE(date_time.weekday == expected.tm_wday);
+	      REQUIRE(date_time.hours == expected.tm_hour);
+	      REQUIRE(date_time.minutes == expected.tm_min);
+	      REQUIRE(date_time.seconds == expected.tm_sec);
+	    }
+	}
+
+      THEN("Days convert back and forth")
+	{
+	  for(int64_t days = -800000; days < 800000; days += 997)
+	    {
+	      int year;
+	      unsigned month, day;
+	      civil_from_days(days, year, month, day);
+
+	      REQUIRE(days_from_civil(year, month, day) == days);
+	    }
+
+	  REQUIRE(days_from_civil(1970, 1, 1) == 0);
+	  REQUIRE(days_from_civil(2000, 2, 29) == 11016);
+	  REQUIRE(days_from_civil(1969, 12, 31) == -1);
+	  REQUIRE(weekday_from_days(-1) == 3);
+	}
+
+      THEN("A time point is floored to the second")
+	{
+	  typedef std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds> time_point_t;
+
+	  REQUIRE(epoch_seconds(time_point_t(std::chrono::milliseconds(1500))) == 1);
+	  REQUIRE(epoch_seconds(time_point_t(std::chrono::milliseconds(-1500))) == -2);
+	  REQUIRE(epoch_seconds(time_point_t(std::chrono::milliseconds(-2000))) == -2);
+	}
+    }
+
+  FOR("Date handlers")
+    {
+      const time_t now = 784111777;//Sun, 06 Nov 1994 08:49:37 GMT
+      const std::chrono::system_clock::time_point time_point = std::chrono::system_clock::from_time_t(now) + std::chrono::milliseconds(999);
+
+      typedef universal_timezone_t<config::dynamic, align::left, ' '> timezone_t;
+
+      GIVEN_A_BUFFER(64)
+      {
+	THEN("They accept a timestamp")
+	  {
+	    end = asc::date<config::dynamic, action::prepare>(begin, now);
+	    REQUIRE(std::string(begin, end) == "Sun Nov 06 08:49:37 1994");
+
+	    end = rfc822::date<config::dynamic, true, true, timezone_t, action::prepare>(begin, now, timezone_t());
+	    REQUIRE(std::string(begin, end) == "Sun, 06 Nov 94 08:49:37 GMT");
+
+	    end = rfc850::date<config::dynamic, timezone_t, action::prepare>(begin, now, timezone_t());
+	    end = rfc850::date<config::dynamic, timezone_t, action::write>(begin, now, timezone_t());
+	    REQUIRE(std::string(begin, end) == "   Sunday, 06-Nov-94 08:49:37 GMT");
+
+	    end = rfc1123::date<config::dynamic, true, true, timezone_t, action::prepare>(begin, now, timezone_t());
+	    REQUIRE(std::string(begin, end) == "Sun, 06 Nov 1994 08:49:37 GMT");
+
+	    end = rfc5322::date<config::dynamic, action::prepare>(begin, now, false, 2, 30);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 -0230");
+
+	    end = rfc7231::date<config::dynamic, action::prepare>(begin, now);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 GMT");
+
+	    end = time_<config::dynamic, action::prepare>(begin, now);
+	    REQUIRE(std::string(begin, end) == "08:49:37");
+
+	    end = time_<config::dynamic, action::write>(begin, (time_t)-1);
+	    REQUIRE(std::string(begin, end) == "23:59:59");
+	  }
+
+	THEN("They accept a time point")
+	  {
+	    end = asc::date<config::dynamic, action::prepare>(begin, time_point);
+	    REQUIRE(std::string(begin, end) == "Sun Nov 06 08:49:37 1994");
+
+	    end = rfc822::date<config::dynamic, true, true, timezone_t, action::prepare>(begin, time_point, timezone_t());
+	    REQUIRE(std::string(begin, end) == "Sun, 06 Nov 94 08:49:37 GMT");
+
+	    end = rfc1123::date<config::dynamic, false, true, timezone_t, action::prepare>(begin, time_point, timezone_t());
+	    REQUIRE(std::string(begin, end) == "06 Nov 1994 08:49:37 GMT");
+
+	    end = rfc5322::date<config::dynamic, action::prepare>(begin, time_point, true, 0, 0);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 +0000");
+
+	    end = rfc7231::date<config::dynamic, action::prepare>(begin, time_point);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 GMT");
+
+	    end = time_<config::dynamic, action::prepare>(begin, time_point);
+	    REQUIRE(std::string(begin, end) == "08:49:37");
+	  }
+      }
+    }
+}
+
 SCENARIO("Character", "[character]")
 {
   char c = '\0';
@@ -254,6 +392,88 @@ struct element_handler_with_max_size_t
 
 using separator_t = character_separator_t<' '>;
 
+SCENARIO("Clock", "[clock]")
+{
+  const time_t now = 784111777;//Sun, 06 Nov 1994 08:49:37 GMT
+
+  date_clock_t clock;
+
+  FOR("Every format")
+    {
+      GIVEN_A_BUFFER(64)
+      {
+	THEN("The length matches the handlers")
+	  {
+	    REQUIRE((std::size_t)asc::date<config::dynamic, action::size>(nullptr, std::tm()) == clock_format_length(clock_format::asc));
+	    REQUIRE((std::size_t)rfc7231::date<config::dynamic, action::size>(nullptr, std::tm()) == clock_format_length(clock_format::rfc7231));
+	    REQUIRE((std::size_t)rfc5322::date<config::dynamic, action::size>(nullptr, std::tm(), true, 0, 0) == clock_format_length(clock_format::rfc5322));
+	  }
+
+	THEN("Copy the cached date")
+	  {
+	    end = cached_date<config::dynamic, clock_format::asc, action::prepare>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "Sun Nov 06 08:49:37 1994");
+
+	    end = cached_date<config::dynamic, clock_format::rfc822, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "Sun, 06 Nov 94 08:49:37 GMT");
+
+	    end = cached_date<config::dynamic, clock_format::rfc850, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "   Sunday, 06-Nov-94 08:49:37 GMT");
+
+	    end = cached_date<config::dynamic, clock_format::rfc1123, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "Sun, 06 Nov 1994 08:49:37 GMT");
+
+	    end = cached_date<config::dynamic, clock_format::rfc5322, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 +0000");
+
+	    end = cached_date<config::dynamic, clock_format::rfc7231, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 GMT");
+
+	    end = cached_date<config::dynamic, clock_format::iso8601, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37Z");
+	  }
+      }
+    }
+
+  FOR("A ticking clock")
+    {
+      REQUIRE(clock.tick(now));
+      REQUIRE_FALSE(clock.tick(now));
+
+      GIVEN_A_BUFFER(32)
+      {
+	THEN("A new second is rendered on first use")
+	  {
+	    end = cached_date<config::dynamic, clock_format::iso8601, action::write>(begin, clock, now + 1);
+
+	    REQUIRE(std::string(begin, end) == "1994-11-06T08:49:38Z");
+	    REQUIRE_FALSE(clock.tick(now + 1));
+	  }
+
+	THEN("An older second is rendered directly")
+	  {
+	    REQUIRE(clock.tick(now + 1));
+	    REQUIRE_FALSE(clock.tick(now));
+
+	    end = cached_date<config::dynamic, clock_format::iso8601, action::write>(begin, clock, now);
+	    REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37Z");
+
+	    end = cached_date<config::dynamic, clock_format::iso8601, action::write>(begin, clock, now + 1);
+	    REQUIRE(std::string(begin, end) == "1994-11-06T08:49:38Z");
+	    REQUIRE_FALSE(clock.tick(now + 1));
+	  }
+
+	THEN("Nothing is written when static")
+	  {
+	    end = cached_date<config::static_, clock_format::iso8601, action::write>(begin, clock, now);
+
+	    REQUIRE(std::size_t(end - begin) == 20);
+	    REQUIRE(begin[0] == '\0');
+	  }
+      }
+    }
+}
+
 SCENARIO("Container", "[container]")
 {
   typedef std::vector<std::pair<const char *, std::size_t> > list_type;
@@ -1290,574 +1510,2612 @@ SCENARIO("Date", "[date]")
 	    }
 	}
     }
-}
 
-SCENARIO("Helper", "[helper]")
-{
-  static_assert(must_write(config::static_, action::prepare), "");
-  static_assert(write_when_reset(action::reset) == action::write, "");
-
-  const char pad = ' ';
+  FOR("An ISO 8601 date")
+    {
+      const time_t now = 784111777;//1994-11-06T08:49:37Z
 
-  const char reference[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.";
-  char buffer[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.";
-  const std::size_t max_length = std::strlen(buffer);
-  char * begin = buffer;
-  char * end = buffer + max_length;
+      typedef military_timezone_t<config::dynamic> utc_t;
+      typedef differential_timezone_t<config::dynamic, int, int, ':'> offset_t;
 
-  GIVEN("A buffer")
-    {
-      WHEN("Pad left")
+      GIVEN_A_BUFFER(40)
 	{
-	  std::size_t previous_length = max_length;
-
-	  WHEN("Use previous length")
+	  THEN("Without fractional seconds")
 	    {
-	      THEN("Keep all")
-		{
-		  pad_left<true, pad>(begin + max_length, end, max_length, previous_length);
+	      REQUIRE((std::size_t)rfc3339::date<config::dynamic, precision::seconds, utc_t, action::size>(nullptr, now, utc_t()) == 20);
 
-		  REQUIRE(previous_length == max_length);
-		  REQUIRE(std::string(begin, end) == reference);
-		}
+	      end = iso8601::date<config::dynamic, precision::seconds, utc_t, action::prepare>(begin, now, utc_t());
+	      REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37Z");
 
-	      THEN("Keep all characters but the first 10")
-		{
-		  pad_left<true, pad>(begin, end - 10, max_length, previous_length);
+	      std::tm date_time = std::tm();
+	      date_time.tm_year = 126;
+	      date_time.tm_mon = 9;
+	      date_time.tm_mday = 17;
+	      date_time.tm_hour = 12;
 
-		  REQUIRE(previous_length == 10);
-		  REQUIRE(std::string(begin, end) == (std::string(max_length - 10, pad) + std::string(reference).substr(max_length - 10)));
-		}
+	      end = iso8601::date<config::dynamic, precision::seconds, offset_t, action::prepare>(begin, date_time, offset_t(false, 3, 30));
+	      REQUIRE(std::string(begin, end) == "2026-10-17T12:00:00-03:30");
 	    }
 
-	  WHEN("Not use previous length")
+	  THEN("With fractional seconds")
 	    {
-	      THEN("Keep all characters but the first 10")
-		{
-		  pad_left<false, pad>(begin, end - 10, max_length, previous_length);
+	      timespec time;
+	      time.tv_sec = now;
+	      time.tv_nsec = 123456789;
 
-		  REQUIRE(std::string(begin, end) == std::string(max_length - 10, pad) + std::string(reference).substr(max_length - 10));
-		}
-	    }
-	}
+	      REQUIRE((std::size_t)iso8601::date<config::dynamic, precision::milliseconds, utc_t, action::size>(nullptr, time, utc_t()) == 24);
 
-      WHEN("Pad right")
-	{
-	  std::size_t previous_length = max_length;
+	      end = iso8601::date<config::dynamic, precision::milliseconds, utc_t, action::prepare>(begin, time, utc_t());
+	      REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37.123Z");
 
-	  WHEN("Use previous length")
-	    {
-	      THEN("Keep all")
-		{
-		  pad_right<true, pad>(begin, end, max_length, previous_length);
+	      end = iso8601::date<config::dynamic, precision::microseconds, offset_t, action::prepare>(begin, time, offset_t(true, 1, 0));
+	      REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37.123456+01:00");
 
-		  REQUIRE(previous_length == max_length);
-		  REQUIRE(std::string(begin, end) == reference);
-		}
+	      end = iso8601::date<config::dynamic, precision::nanoseconds, utc_t, action::prepare>(begin, time, utc_t());
+	      REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37.123456789Z");
 
-	      THEN("Keep first 10 characters")
-		{
-		  pad_right<true, pad>(begin, begin + 10, max_length, previous_length);
+	      const std::chrono::time_point<std::chrono::system_clock, std::chrono::microseconds> time_point(std::chrono::microseconds(-1));
 
-		  REQUIRE(previous_length == 10);
-		  REQUIRE(std::string(begin, end) == std::string(reference).substr(0, 10) + std::string(max_length - 10, pad));
-		}
+	      end = iso8601::date<config::dynamic, precision::microseconds, utc_t, action::prepare>(begin, time_point, utc_t());
+	      REQUIRE(std::string(begin, end) == "1969-12-31T23:59:59.999999Z");
 	    }
 
-	  WHEN("Not use previous length")
+	  THEN("A write only updates the digits")
 	    {
-	      THEN("Keep first 10 characters")
-		{
-		  pad_right<false, pad>(begin, begin + 10, max_length, previous_length);
+	      end = iso8601::date<config::dynamic, precision::milliseconds, utc_t, action::prepare>(begin, now, utc_t());
+	      REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37.000Z");
 
-		  REQUIRE(std::string(begin, end) == std::string(reference).substr(0, 10) + std::string(max_length - 10, pad));
-		}
+	      begin[4] = begin[10] = begin[19] = '_';
+
+	      const std::chrono::system_clock::time_point time_point = std::chrono::system_clock::from_time_t(now + 86400) + std::chrono::milliseconds(42);
+
+	      end = iso8601::date<config::dynamic, precision::milliseconds, utc_t, action::write>(begin, time_point, utc_t());
+	      REQUIRE(std::string(begin, end) == "1994_11-07_08:49:37_042Z");
+	    }
+
+	  THEN("Nothing is written when static")
+	    {
+	      end = iso8601::date<config::static_, precision::milliseconds, utc_t, action::prepare>(begin, now, utc_t());
+	      end = iso8601::date<config::static_, precision::milliseconds, utc_t, action::write>(begin, now + 1, utc_t());
+	      REQUIRE(std::string(begin, end) == "1994-11-06T08:49:37.000Z");
 	    }
 	}
     }
 }
 
-SCENARIO("Itoa adapter", "[itoa, adapter]")
+SCENARIO("Date time", "[date]")
 {
-  WHEN("To string")
-    {
-      adapter::itoa::to_string_t to_string;
+  const time_t now = 784111777;//Sun, 06 Nov 1994 08:49:37 GMT
 
+  typedef universal_timezone_t<config::dynamic, align::left, ' '> timezone_t;
+
+  FOR("Every format")
+    {
       GIVEN_A_BUFFER(64)
-	{
-	  WHEN("Forward")
-	    {
+      {
+	THEN("The time offset points at the hours")
+	  {
+	    const time_t date_time = 12 * 3600;
 
-#define TEST(I, L)						\
-	      THEN(#I)						\
-		{						\
-		  end = to_string.fwd(begin, I);		\
-								\
-		  REQUIRE(std::size_t(end - begin) == L);			\
-		  REQUIRE(std::string(begin, end) == #I);	\
-		}
+	    end = asc::format_t().handle<config::dynamic, action::write>(begin, date_time);
+	    REQUIRE(std::string(begin + asc::format_t::time_offset, 2) == "12");
 
-	      TEST(0, 1);
-	      TEST(1, 1);
-	      TEST(10, 2);
-	      TEST(99, 2);
-	      TEST(3993, 4);
+	    end = rfc822::format_t<true, true, timezone_t>().handle<config::dynamic, action::write>(begin, date_time);
+	    REQUIRE(std::string(begin + rfc822::format_t<true, true, timezone_t>::time_offset, 2) == "12");
 
-#undef TEST
-	    }
+	    end = rfc850::format_t<timezone_t>().handle<config::dynamic, action::write>(begin, date_time);
+	    REQUIRE(std::string(begin + rfc850::format_t<timezone_t>::time_offset, 2) == "12");
 
-	  WHEN("Backward")
-	    {
-#define TEST(I, L)						\
-	      THEN(#I)						\
-		{						\
-		  begin = to_string.bwd(end, I);		\
-								\
-		  REQUIRE(std::size_t(end - begin) == L);			\
-		  REQUIRE(std::string(begin, end) == #I);	\
-		}
+	    end = rfc1123::format_t<false, true, timezone_t>().handle<config::dynamic, action::write>(begin, date_time);
+	    REQUIRE(std::string(begin + rfc1123::format_t<false, true, timezone_t>::time_offset, 2) == "12");
 
-	      TEST(0, 1);
-	      TEST(1, 1);
-	      TEST(10, 2);
-	      TEST(99, 2);
-	      TEST(3993, 4);
+	    end = rfc5322::format_t<int, int>().handle<config::dynamic, action::write>(begin, date_time);
+	    REQUIRE(std::string(begin + rfc5322::format_t<int, int>::time_offset, 2) == "12");
 
-#undef TEST
-	    }
-	}
+	    end = rfc7231::format_t().handle<config::dynamic, action::write>(begin, date_time);
+	    REQUIRE(std::string(begin + rfc7231::format_t::time_offset, 2) == "12");
+	    REQUIRE(std::size_t(end - begin) == 29);
+
+	  }
+      }
     }
-}
 
-SCENARIO("Nothing", "[nothing]")
-{
-  char c;
+  FOR("An incremental date")
+    {
+      rfc7231::date_time_t<config::dynamic> date_time;
 
-  REQUIRE(((std::size_t)nothing_t().handle<action::size>(nullptr) == 0));
-  REQUIRE(nothing_t().handle<action::prepare>(&c) == &c);
-  REQUIRE(nothing_t().handle<action::write>(&c) == &c);
-  REQUIRE(nothing_t().handle<action::reset>(&c) == &c);
-}
+      GIVEN_A_BUFFER(32)
+      {
+	const std::size_t size = 29;
 
-SCENARIO("Number", "[number]")
-{
-  {
-    REQUIRE(details::digits<uint8_t>(0) == 1);
-    REQUIRE(details::digits<uint8_t>(1) == 1);
-    REQUIRE(details::digits<uint8_t>(4) == 1);
-    REQUIRE(details::digits<uint8_t>(67) == 2);
-    REQUIRE(details::digits<uint8_t>(234) == 3);
+	end = date_time.handle<action::size>(nullptr, now);
+	REQUIRE((std::size_t)end == size);
 
-    REQUIRE(details::digits<int>(-1) == 2);
-    REQUIRE(details::digits<int>(-4) == 2);
-    REQUIRE(details::digits<int>(-34) == 3);
-  }
+	end = date_time.handle<action::prepare>(begin, now);
+	REQUIRE(std::size_t(end - begin) == size);
 
-  const char pad = ' ';
+	end = date_time.handle<action::write>(begin, now);
+	REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:37 GMT");
 
-  FOR("Two digits numbers")
-    {
-      FOR("A static or a dynamic configuration")
-	{
-	  FOR("A leading zero")
-	    {
-	      FIRST("Get the size")
-		{
-		  REQUIRE(((std::size_t)two_digits_number<config::static_, '\0', action::size, uint8_t>(nullptr, 0) == 2));
+	THEN("Only the time is rewritten within the same day")
+	  {
+	    begin[0] = 'X';
 
-		  GIVEN_A_BUFFER(2)
-		    {
-		      THEN("Prepare")
-			{
-			  end = two_digits_number<config::static_, '\0', action::prepare, uint8_t>(begin, 43);
+	    end = date_time.handle<action::write>(begin, now + 1);
+	    REQUIRE(std::string(begin, end) == "Xun,  6 Nov 1994 08:49:38 GMT");
 
-			  REQUIRE(std::size_t(end - begin) == 2);
-			  REQUIRE(std::string(begin, end) == "43");
-			}
+	    end = date_time.handle<action::write>(begin, now + 23);
+	    REQUIRE(std::string(begin, end) == "Xun,  6 Nov 1994 08:50:00 GMT");
 
-		      THEN("Prepare")
-			{
-			  end = two_digits_number<config::static_, '\0', action::prepare, uint8_t>(begin, 7);
+	    end = date_time.handle<action::write>(begin, now + 3600 * 15 + 60 * 10 + 22);
+	    REQUIRE(std::string(begin, end) == "Xun,  6 Nov 1994 23:59:59 GMT");
 
-			  REQUIRE(std::size_t(end - begin) == 2);
-			  REQUIRE(std::string(begin, end) == "07");
-			}
+	    end = date_time.handle<action::write>(begin, now - 3600 * 8 - 60 * 49 - 37);
+	    REQUIRE(std::string(begin, end) == "Xun,  6 Nov 1994 00:00:00 GMT");
 
-		      THEN("Prepare")
-			{
-			  end = two_digits_number<config::static_, '\0', action::prepare, uint8_t>(begin, 0);
+	    THEN("The whole date is rewritten on a day rollover")
+	      {
+		end = date_time.handle<action::write>(begin, now + 3600 * 15 + 60 * 10 + 23);
+		REQUIRE(std::string(begin, end) == "Mon,  7 Nov 1994 00:00:00 GMT");
+	      }
+	  }
 
-			  REQUIRE(std::size_t(end - begin) == 2);
-			  REQUIRE(std::string(begin, end) == "00");
-			}
-		    }
-		}
-	    }
-
-	  FOR("A leading space")
-	    {
-	      FIRST("Get the Size")
-		{
-		  REQUIRE(((std::size_t)two_digits_number<config::static_, pad, action::size, uint8_t>(nullptr, 0) == 2));
-		  GIVEN_A_BUFFER(2)
-		    {
-		      THEN("Prepare")
-			{
-			  end = two_digits_number<config::static_, pad, action::prepare, uint8_t>(begin, 99);
-
-			  REQUIRE(std::size_t(end - begin) == 2);
-			  REQUIRE(std::string(begin, end) == "99");
-			}
-
-		      THEN("Prepare")
-			{
-			  end = two_digits_number<config::static_, pad, action::prepare, uint8_t>(begin, 7);
+	THEN("Reset forces a full rewrite")
+	  {
+	    end = date_time.handle<action::reset>(begin, now);
+	    REQUIRE(std::size_t(end - begin) == size);
 
-			  REQUIRE(std::size_t(end - begin) == 2);
-			  REQUIRE(std::string(begin, end) == " 7");
-			}
+	    begin[0] = 'X';
 
-		      THEN("Prepare")
-			{
-			  end = two_digits_number<config::static_, pad, action::prepare, uint8_t>(begin, 0);
+	    end = date_time.handle<action::write>(begin, now + 1);
+	    REQUIRE(std::string(begin, end) == "Sun,  6 Nov 1994 08:49:38 GMT");
+	  }
+      }
+    }
 
-			  REQUIRE(std::size_t(end - begin) == 2);
-			  REQUIRE(std::string(begin, end) == " 0");
-			}
-		    }
-		}
+  FOR("Every incremental format")
+    {
+      asc::date_time_t<config::dynamic> asc_date_time;
+      rfc822::date_time_t<config::dynamic, true, true, timezone_t> rfc822_date_time;
+      rfc822::date_time_t<config::dynamic, false, false, timezone_t> rfc822_short_date_time;
+      rfc850::date_time_t<config::dynamic, timezone_t> rfc850_date_time;
+      rfc1123::date_time_t<config::dynamic, true, true, timezone_t> rfc1123_date_time;
+      rfc5322::date_time_t<config::dynamic> rfc5322_date_time(rfc5322::format_t<int, int>(false, 1, 30));
+      iso8601::date_time_t<config::dynamic, military_timezone_t<config::dynamic> > iso8601_date_time;
+
+      THEN("They match a full render")
+	{
+	  char buffers[7][64];
+	  char expected[64];
+
+	  asc_date_time.handle<action::prepare>(buffers[0], now);
+	  rfc822_date_time.handle<action::prepare>(buffers[1], now);
+	  rfc822_short_date_time.handle<action::prepare>(buffers[2], now);
+	  rfc850_date_time.handle<action::prepare>(buffers[3], now);
+	  rfc1123_date_time.handle<action::prepare>(buffers[4], now);
+	  rfc5322_date_time.handle<action::prepare>(buffers[5], now);
+	  iso8601_date_time.handle<action::prepare>(buffers[6], now);
+
+	  for(time_t value = now - 90000; value < now + 90000; value += 1021)
+	    {
+#define BUFFER_HANDLE_TEST_DATE_TIME(object, buffer)			\
+	      REQUIRE(std::string(buffer, object.handle<action::write>(buffer, value)) == \
+		      std::string(expected, (object.format.handle<config::dynamic, action::prepare>(expected, value), \
+					    object.format.handle<config::dynamic, action::write>(expected, value))))
+
+	      BUFFER_HANDLE_TEST_DATE_TIME(asc_date_time, buffers[0]);
+	      BUFFER_HANDLE_TEST_DATE_TIME(rfc822_date_time, buffers[1]);
+	      BUFFER_HANDLE_TEST_DATE_TIME(rfc822_short_date_time, buffers[2]);
+	      BUFFER_HANDLE_TEST_DATE_TIME(rfc850_date_time, buffers[3]);
+	      BUFFER_HANDLE_TEST_DATE_TIME(rfc1123_date_time, buffers[4]);
+	      BUFFER_HANDLE_TEST_DATE_TIME(rfc5322_date_time, buffers[5]);
+	      BUFFER_HANDLE_TEST_DATE_TIME(iso8601_date_time, buffers[6]);
+
+#undef BUFFER_HANDLE_TEST_DATE_TIME
 	    }
 	}
     }
 
-  FOR("Four digits numbers")
+  FOR("A static incremental date")
     {
-      FOR("A static or a dynamic configuration")
-	{
-	  FIRST("Get the size")
-	    {
-	      REQUIRE(((std::size_t)four_digits_number<config::static_, action::size, uint16_t>(nullptr, 0) == 4));
-	      GIVEN_A_BUFFER(4)
-		{
-		  THEN("Prepare")
-		    {
-		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 0);
+      rfc7231::date_time_t<config::static_> date_time;
 
-		      REQUIRE(std::size_t(end - begin) == 4);
-		      REQUIRE(std::string(begin, end) == "0000");
-		    }
+      GIVEN_A_BUFFER(32)
+      {
+	end = date_time.handle<action::write>(begin, now);
 
-		  THEN("Prepare")
-		    {
-		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 2);
+	REQUIRE(std::size_t(end - begin) == 29);
+	REQUIRE(begin[0] == '\0');
+      }
+    }
+}
 
-		      REQUIRE(std::size_t(end - begin) == 4);
-		      REQUIRE(std::string(begin, end) == "0002");
-		    }
+SCENARIO("Date parsing", "[date]")
+{
+  const time_t now = 784111777;//Sun, 06 Nov 1994 08:49:37 GMT
 
-		  THEN("Prepare")
-		    {
-		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 56);
+  typedef universal_timezone_t<config::dynamic, align::left, ' '> timezone_t;
 
-		      REQUIRE(std::size_t(end - begin) == 4);
-		      REQUIRE(std::string(begin, end) == "0056");
-		    }
+  FOR("Every format")
+    {
+      GIVEN_A_BUFFER(64)
+      {
+	time_t value;
 
-		  THEN("Prepare")
-		    {
-		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 723);
+	THEN("The emitted dates are parsed back")
+	  {
+	    for(time_t date = now - 86400 * 400; date < now + 86400 * 400; date += 86400 * 3 + 3671)
+	      {
+		end = asc::date<config::dynamic, action::prepare>(begin, date);
+		REQUIRE(asc::parse(begin, end, value) == end);
+		REQUIRE(value == date);
+
+		end = rfc822::date<config::dynamic, true, true, timezone_t, action::prepare>(begin, date, timezone_t());
+		REQUIRE(rfc822::parse(begin, end, value) == end);
+		REQUIRE(value == date);
+
+		end = rfc850::date<config::dynamic, timezone_t, action::prepare>(begin, date, timezone_t());
+		end = rfc850::date<config::dynamic, timezone_t, action::write>(begin, date, timezone_t());
+		REQUIRE(rfc850::parse(begin, end, value) == end);
+		REQUIRE(value == date);
+
+		end = rfc1123::date<config::dynamic, false, true, timezone_t, action::prepare>(begin, date, timezone_t());
+		REQUIRE(rfc1123::parse(begin, end, value) == end);
+		REQUIRE(value == date);
+
+		end = rfc5322::date<config::dynamic, action::prepare>(begin, date, true, 0, 0);
+		REQUIRE(rfc5322::parse(begin, end, value) == end);
+		REQUIRE(value == date);
+
+		end = rfc7231::date<config::dynamic, action::prepare>(begin, date);
+		REQUIRE(rfc7231::parse(begin, end, value) == end);
+		REQUIRE(value == date);
+	      }
+	  }
+      }
+    }
 
-		      REQUIRE(std::size_t(end - begin) == 4);
-		      REQUIRE(std::string(begin, end) == "0723");
-		    }
+  FOR("Calendar fields")
+    {
+      calendar_t value;
+      int offset;
 
-		  THEN("Prepare")
-		    {
-		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 2968);
+      const std::string date = "Sun,  6 Nov 1994 08:49:37 -0230 trailing";
 
-		      REQUIRE(std::size_t(end - begin) == 4);
-		      REQUIRE(std::string(begin, end) == "2968");
-		    }
-		}
-	    }
+      THEN("The fields and the timezone offset are returned")
+	{
+	  REQUIRE(rfc5322::parse(date.data(), date.data() + date.size(), value, offset) == date.data() + 31);
+	  REQUIRE(value.year == 1994);
+	  REQUIRE(value.month == 11);
+	  REQUIRE(value.day == 6);
+	  REQUIRE(value.weekday == 0);
+	  REQUIRE(value.hours == 8);
+	  REQUIRE(value.minutes == 49);
+	  REQUIRE(value.seconds == 37);
+	  REQUIRE(offset == -(2 * 3600 + 30 * 60));
 	}
     }
 
-  FOR("An integral number")
+  FOR("Various timezones")
     {
-      const char pad = ' ';
-      uint8_t max_digits = 0;
-
-      adapter::itoa::to_string_t itoa;
+      time_t value;
 
-      FOR("A static configuration")
+      THEN("They are applied to the timestamp")
 	{
-	  WHEN("Left or right aligned, any padding")
+	  const char * dates[] = {
+	    "06 Nov 94 03:49:37 EST", "06 Nov 94 04:49:37 EDT", "06 Nov 94 00:49:37 PST",
+	    "06 Nov 94 08:49:37 UT", "06 Nov 94 08:49:37 Z", "06 Nov 94 09:49:37 A", "06 Nov 94 07:49:37 N",
+	    "06 Nov 94 10:19:37 +0130", "Sun, 6 Nov 94 08:49:37 GMT"
+	  };
+
+	  for(const char * date : dates)
 	    {
-	      FIRST("Get the size")
-		{
-		  const std::size_t size = (std::size_t)integral_number<config::static_, align::left, pad, action::size>(nullptr, 1998, max_digits, itoa);
+	      REQUIRE(rfc822::parse(date, date + std::strlen(date), value) == date + std::strlen(date));
+	      REQUIRE(value == now);
+	    }
 
-		  GIVEN_A_BUFFER(size)
-		  {
-		    THEN("Prepare")
-		      {
-			end = integral_number<config::static_, align::left, pad, action::prepare>(begin, 1998, max_digits, itoa);
+	  const char date[] = "06 Nov 94 08:49 GMT";
 
-			REQUIRE(end == begin + 4);
-			REQUIRE(max_digits == 4);
-			REQUIRE(std::string(begin, end) == "1998");
-		      }
-		  }
-		}
-	    }
+	  REQUIRE(rfc822::parse(date, date + sizeof(date) - 1, value) == date + sizeof(date) - 1);
+	  REQUIRE(value == now - 37);
 	}
+    }
 
-      FOR("A dynamic configuration")
+  FOR("The obsolete HTTP formats")
+    {
+      time_t value;
+
+      THEN("They are accepted by rfc7231")
 	{
-	  uint8_t previous_digits = 0;
-	  const uint8_t max_digits_ = 8;
+	  const char * dates[] = {
+	    "Sun, 06 Nov 1994 08:49:37 GMT", "Sunday, 06-Nov-94 08:49:37 GMT", "Sun Nov  6 08:49:37 1994"
+	  };
 
-	  WHEN("Left-aligned")
+	  for(const char * date : dates)
 	    {
-	      FIRST("Get the size")
-		{
-		  const std::size_t size = (std::size_t)integral_number<config::dynamic, align::left, pad, action::size>(nullptr, 19237840, max_digits, previous_digits, itoa);
-
-		  REQUIRE(size == max_digits_);
-		  REQUIRE(previous_digits == 0);
-
-		  GIVEN_A_BUFFER(size)
-		  {
-		    THEN("Prepare")
-		      {
-			end = integral_number<config::dynamic, align::left, pad, action::prepare>(begin, 19237840, max_digits, previous_digits, itoa);
+	      REQUIRE(rfc7231::parse(date, date + std::strlen(date), value) == date + std::strlen(date));
+	      REQUIRE(value == now);
+	    }
 
-			REQUIRE(std::size_t(end - begin) == max_digits_);
-			REQUIRE(max_digits == max_digits_);
-			REQUIRE(previous_digits == 0);
-			REQUIRE(std::string(begin, end) == "        ");
+	  const char date[] = "Sunday, 06-Nov-94 08:49:37 EST";
 
-			THEN("Write")
-			  {
-			    end = integral_number<config::dynamic, align::left, pad, action::write>(begin, 1923784, max_digits, previous_digits, itoa);
+	  REQUIRE(rfc7231::parse(date, date + sizeof(date) - 1, value) == nullptr);
+	}
+    }
 
-			    REQUIRE(std::size_t(end - begin) == max_digits_);
-			    REQUIRE(max_digits == max_digits_);
-			    REQUIRE(previous_digits == 7);
-			    REQUIRE(std::string(begin, end) == "1923784 ");
+  FOR("Invalid dates")
+    {
+      time_t value;
 
-			    THEN("Reset")
-			      {
-				end = integral_number<config::dynamic, align::left, pad, action::reset>(begin, 19, max_digits, previous_digits, itoa);
+      THEN("They are rejected")
+	{
+	  const char * dates[] = {
+	    "Mon, 06 Nov 1994 08:49:37 GMT", "Sun, 31 Nov 1994 08:49:37 GMT", "Sun, 06 Nov 1994 24:49:37 GMT",
+	    "Sun, 06 Nov 1994 08:60:37 GMT", "Sun, 06 Nox 1994 08:49:37 GMT", "Sun, 06 Nov 1994 08:49:37 XYZ",
+	    "Sun, 06 Nov 19a4 08:49:37 GMT", "Sun, 06 Nov 1994 08:49", "Sun, 06 Nov 1994 08:49:37 +2", "",
+	    "Sun, 29 Feb 1995 08:49:37 GMT", "Sun, 00 Nov 1994 08:49:37 GMT"
+	  };
+
+	  for(const char * date : dates)
+	    {
+	      REQUIRE(rfc1123::parse(date, date + std::strlen(date), value) == nullptr);
+	      REQUIRE(rfc7231::parse(date, date + std::strlen(date), value) == nullptr);
+	    }
+	}
+    }
+}
 
-				REQUIRE(std::size_t(end - begin) == max_digits_);
-				REQUIRE(max_digits == max_digits_);
-				REQUIRE(previous_digits == 0);
-				REQUIRE(std::string(begin, end) == std::string(max_digits_, pad));
+SCENARIO("Duration", "[duration]")
+{
+  const uint64_t uptime = ((3 * 86400 + 4 * 3600 + 5 * 60 + 6) * 1000 + 789) * uint64_t(1000000);//3d 04:05:06.789
 
-				THEN("Write")
-				  {
-				    end = integral_number<config::dynamic, align::left, pad, action::write>(begin, 7326, max_digits, previous_digits, itoa);
+  FOR("The clock format")
+    {
+      GIVEN_A_BUFFER(32)
+      {
+	const std::size_t size = 17;
 
-				    REQUIRE(std::size_t(end - begin) == max_digits_);
-				    REQUIRE(max_digits == max_digits_);
-				    REQUIRE(previous_digits == 4);
-				    REQUIRE(std::string(begin, end) == "7326" + std::string(max_digits_ - 4, pad));
-				  }
-			      }
-			  }
-		      }
-		  }
-		}
-	    }
+	end = duration<config::dynamic, duration_format::clock, 3, precision::milliseconds, action::size>(nullptr, uptime);
+	REQUIRE((std::size_t)end == size);
 
-	  WHEN("Right-aligned")
-	    {
-	      FIRST("Get the size")
-		{
-		  const std::size_t size = (std::size_t)integral_number<config::dynamic, align::right, pad, action::size>(nullptr, 19237840, max_digits, previous_digits, itoa);
+	end = duration<config::dynamic, duration_format::clock, 3, precision::milliseconds, action::prepare>(begin, uptime);
+	REQUIRE(std::size_t(end - begin) == size);
 
-		  REQUIRE(size == max_digits_);
-		  REQUIRE(previous_digits == 0);
+	end = duration<config::dynamic, duration_format::clock, 3, precision::milliseconds, action::write>(begin, uptime);
+	REQUIRE(std::string(begin, end) == "  3d 04:05:06.789");
 
-		  GIVEN_A_BUFFER(size)
-		  {
-		    THEN("Prepare")
-		      {
-			end = integral_number<config::dynamic, align::right, pad, action::prepare>(begin, 19237840, max_digits, previous_digits, itoa);
+	end = duration<config::dynamic, duration_format::clock, 3, precision::milliseconds, action::write>(begin, std::chrono::hours(24 * 123) + std::chrono::seconds(59));
+	REQUIRE(std::string(begin, end) == "123d 00:00:59.000");
 
-			REQUIRE(std::size_t(end - begin) == max_digits_);
-			REQUIRE(max_digits == max_digits_);
-			REQUIRE(previous_digits == 0);
-			REQUIRE(std::string(begin, end) == "        ");
+	end = duration<config::static_, duration_format::clock, 1, precision::seconds, action::prepare>(begin, std::chrono::seconds(3599));
+	REQUIRE(std::string(begin, end) == "0d 00:59:59");
+      }
+    }
 
-			THEN("Write")
-			  {
-			    end = integral_number<config::dynamic, align::right, pad, action::write>(begin, 1923784, max_digits, previous_digits, itoa);
+  FOR("The unit format")
+    {
+      GIVEN_A_BUFFER(32)
+      {
+	const std::size_t size = 10;
 
-			    REQUIRE(std::size_t(end - begin) == max_digits_);
-			    REQUIRE(max_digits == max_digits_);
-			    REQUIRE(previous_digits == 7);
-			    REQUIRE(std::string(begin, end) == " 1923784");
+	end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::size>(nullptr, 0);
+	REQUIRE((std::size_t)end == size);
 
-			    THEN("Reset")
-			      {
-				end = integral_number<config::dynamic, align::right, pad, action::reset>(begin, 19, max_digits, previous_digits, itoa);
+	end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::prepare>(begin, 0);
+	REQUIRE(std::size_t(end - begin) == size);
 
-				REQUIRE(std::size_t(end - begin) == max_digits_);
-				REQUIRE(max_digits == max_digits_);
-				REQUIRE(previous_digits == 0);
-				REQUIRE(std::string(begin, end) == std::string(max_digits_, pad));
+	end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::write>(begin, std::chrono::microseconds(123456));
+	REQUIRE(std::string(begin, end) == "123.456 ms");
 
-				THEN("Write")
-				  {
-				    end = integral_number<config::dynamic, align::right, pad, action::write>(begin, 7236, max_digits, previous_digits, itoa);
+	end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::write>(begin, 999);
+	REQUIRE(std::string(begin, end) == "999.000 ns");
 
-				    REQUIRE(std::size_t(end - begin) == max_digits_);
-				    REQUIRE(max_digits == max_digits_);
-				    REQUIRE(previous_digits == 4);
-				    REQUIRE(std::string(begin, end) == std::string(max_digits_ - 4, pad) + "7236");
-				  }
-			      }
-			  }
-		      }
-		  }
-		}
-	    }
-	}
-    }
+	end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::write>(begin, std::chrono::nanoseconds(1500));
+	REQUIRE(std::string(begin, end) == "  1.500 us");
 
-  adapter::itoa::to_string_t itoa;
+	end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::write>(begin, std::chrono::milliseconds(61250));
+	REQUIRE(std::string(begin, end) == "  61.250 s");
 
-  FOR("integral_number_t<config::static_>")
-    {
-      typedef integral_number_t<config::static_, align::left, ' ', uint8_t> number_type;
+	end = duration<config::dynamic, duration_format::unit, 3, precision::seconds, action::write>(begin, std::chrono::seconds(42));
+	REQUIRE(std::string(begin, end) == "  42 s");
 
-      number_type number = number_type();
+	THEN("An oversized value saturates")
+	  {
+	    end = duration<config::dynamic, duration_format::unit, 3, precision::milliseconds, action::write>(begin, std::chrono::seconds(1000));
+	    REQUIRE(std::string(begin, end) == " 999.999 s");
+	    REQUIRE(end == begin + size);
 
-      const std::size_t size = (std::size_t)number.handle<action::size>(nullptr, 11, itoa);
+	    end = duration<config::dynamic, duration_format::unit, 1, precision::seconds, action::write>(begin, std::numeric_limits<uint64_t>::max());
+	    REQUIRE(std::string(begin, end) == " 9 s");
 
-      REQUIRE(size == 2);
+	    end = duration<config::dynamic, duration_format::unit, 20, precision::seconds, action::write>(begin, std::numeric_limits<uint64_t>::max());
+	    REQUIRE(std::string(begin, end) == "          18446744073 s");
+	  }
+      }
     }
 
-  FOR("integral_number_t<config::dynamic>")
+  FOR("An incremental duration")
     {
-      typedef integral_number_t<config::dynamic, align::left, ' ', uint8_t> number_type;
+      duration_t<config::dynamic, duration_format::clock, 2, precision::seconds> value;
 
-      number_type number = number_type();
+      GIVEN_A_BUFFER(32)
+      {
+	const std::size_t size = 12;
 
-      const std::size_t size = (std::size_t)number.handle<action::size>(nullptr, 183, itoa);
+	end = value.handle<action::size>(nullptr, 0);
+	REQUIRE((std::size_t)end == size);
 
-      REQUIRE(size == 3);
-    }
+	end = value.handle<action::prepare>(begin, 0);
+	REQUIRE(std::size_t(end - begin) == size);
 
-  FOR("integral_number_t<config::dynamic, ..., true>")
-    {
+	end = value.handle<action::write>(begin, std::chrono::seconds(86399));
+	REQUIRE(std::string(begin, end) == " 0d 23:59:59");
+
+	THEN("Only the changed fields are rewritten")
+	  {
+	    begin[0] = 'X';
+
+	    end = value.handle<action::write>(begin, std::chrono::seconds(86399) + std::chrono::milliseconds(500));
+	    REQUIRE(std::string(begin, end) == "X0d 23:59:59");
+
+	    begin[4] = 'X';
+
+	    end = value.handle<action::write>(begin, std::chrono::seconds(86400 - 30));
+	    REQUIRE(std::string(begin, end) == "X0d X3:59:30");
+
+	    end = value.handle<action::write>(begin, std::chrono::seconds(86400 + 3600));
+	    REQUIRE(std::string(begin, end) == " 1d 01:00:00");
+
+	    end = value.handle<action::write>(begin, std::chrono::seconds(86400 * 12));
+	    REQUIRE(std::string(begin, end) == "12d 00:00:00");
+	  }
+      }
+    }
+}
+
+enum class level_t : uint8_t
+{
+  debug,
+    info,
+    warning,
+    error
+    };
+
+struct level_enumeration_t
+{
+  typedef level_t value_type;
+
+  static constexpr std::size_t count = 4;
+
+  static const char * get(level_t value)
+  {
+    static const char * names[] = {"DEBUG", "INFO", "WARNING", "ERROR"};
+
+    return names[(std::size_t)value];
+  }
+};
+
+SCENARIO("Enumeration", "[enumeration]")
+{
+  FOR("A static configuration")
+    {
+      REQUIRE(((std::size_t)enumeration<level_enumeration_t, action::size>(nullptr, level_t::info) == 4));
+
+      GIVEN_A_BUFFER(4)
+	{
+	  end = enumeration<config::static_, align::left, ' ', level_enumeration_t, action::prepare>(begin, level_t::info);
+	  REQUIRE(std::string(begin, end) == "INFO");
+
+	  REQUIRE(enumeration<config::static_, align::left, ' ', level_enumeration_t, action::write>(begin, level_t::info) == end);
+	  REQUIRE(std::string(begin, end) == "INFO");
+	}
+    }
+
+  FOR("A dynamic configuration")
+    {
+      enumeration_t<config::dynamic, align::right, '.', level_enumeration_t> handler;
+
+      REQUIRE(((std::size_t)handler.handle<action::size>(nullptr, level_t::info) == 7));
+
+      GIVEN_A_BUFFER(7)
+	{
+	  end = handler.handle<action::prepare>(begin, level_t::info);
+	  REQUIRE(std::string(begin, end) == ".......");
+
+	  handler.handle<action::write>(begin, level_t::warning);
+	  REQUIRE(std::string(begin, end) == "WARNING");
+
+	  handler.handle<action::write>(begin, level_t::debug);
+	  REQUIRE(std::string(begin, end) == "..DEBUG");
+
+	  handler.handle<action::reset>(begin, level_t::debug);
+	  REQUIRE(std::string(begin, end) == ".......");
+	}
+    }
+}
+
+template<config Config, action Action, class Handles>
+char * status_line(char * buffer, unsigned short code, const char * reason, std::size_t length, Handles & handles)
+{
+  unsigned char code_max_digits = 3;
+  unsigned char length_max_digits = 6;
+
+  buffer = string<config::static_, Action>(buffer, "HTTP/1.1 ");
+  buffer = handles.template record<Action, align::right, ' '>
+    (buffer, integral_number<Config, align::right, ' ', Action, adapter::itoa::to_string_t>(buffer, code, code_max_digits));
+  buffer = space<config::static_, Action>(buffer);
+  buffer = handles.template record<Action, align::left, ' '>
+    (buffer, string<Config, align::left, ' ', Action>(buffer, reason, std::strlen(reason), 10));
+  buffer = string<config::static_, Action>(buffer, "\r\nContent-Length: ");
+  buffer = handles.template record<Action, align::right, '0'>
+    (buffer, integral_number<Config, align::right, '0', Action, adapter::itoa::to_string_t>(buffer, length, length_max_digits));
+
+  return buffer;
+}
+
+SCENARIO("Field handle", "[field_handle]")
+{
+  GIVEN_A_BUFFER(64)
+  {
+    field_handles_t<4> handles(begin);
+
+    end = status_line<config::dynamic, action::prepare>(begin, 999, "", 999999, handles);
+    REQUIRE(std::string(begin, end) == "HTTP/1.1               \r\nContent-Length: 000000");
+
+    THEN("The prepare action records the dynamic fields")
+      {
+	REQUIRE(handles.size() == 3);
+
+	REQUIRE(handles[0].offset == 9);
+	REQUIRE(handles[0].width == 3);
+	REQUIRE(handles[0].alignment == align::right);
+
+	REQUIRE(handles[1].offset == 13);
+	REQUIRE(handles[1].width == 10);
+	REQUIRE(handles[1].alignment == align::left);
+
+	REQUIRE(handles[2].offset == 41);
+	REQUIRE(handles[2].width == 6);
+	REQUIRE(handles[2].pad == '0');
+      }
+
+    THEN("A field is rewritten on its own")
+      {
+	handles[0].write<adapter::itoa::to_string_t>(begin, 200);
+	handles[1].write(begin, "OK");
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 OK        \r\nContent-Length: 000000");
+
+	handles[2].write<adapter::itoa::to_string_t>(begin, 1234);
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 OK        \r\nContent-Length: 001234");
+
+	handles[1].write(begin, "Not Found");
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 Not Found \r\nContent-Length: 001234");
+
+	handles[1].write(begin, "Gone");
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 Gone      \r\nContent-Length: 001234");
+
+	handles[0].reset(begin);
+	REQUIRE(std::string(begin, end) == "HTTP/1.1     Gone      \r\nContent-Length: 001234");
+
+	THEN("The handles match the template walk")
+	  {
+	    char * expected = (char *)alloca(end - begin);
+
+	    field_handles_t<4> other(expected);
+
+	    status_line<config::dynamic, action::prepare>(expected, 999, "", 999999, other);
+	    status_line<config::dynamic, action::write>(expected, 404, "Gone", 1234, other);
+
+	    handles[0].write<adapter::itoa::to_string_t>(begin, 404);
+	    REQUIRE(std::string(begin, end) == std::string(expected, end - begin));
+	    REQUIRE(other.size() == 3);
+	  }
+      }
+
+    THEN("The buffer is emitted without the padding of its fields")
+      {
+	field_extents_t<4> extents(handles);
+
+	REQUIRE(extents.compact_size(end - begin) == (std::size_t)(end - begin) - 3 - 10 - 6);
+
+	extents.write<adapter::itoa::to_string_t>(begin, 0, 200);
+	extents.write(begin, 1, "OK");
+	extents.write<adapter::itoa::to_string_t>(begin, 2, 1234);
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 OK        \r\nContent-Length: 001234");
+
+	const std::string expected = "HTTP/1.1 200 OK\r\nContent-Length: 1234";
+
+	REQUIRE(extents.compact_size(end - begin) == expected.size());
+
+	char compacted[64];
+
+	REQUIRE(extents.compact(compacted, begin, end - begin) == compacted + expected.size());
+	REQUIRE(std::string(compacted, expected.size()) == expected);
+
+	iovec iov[2 * 4 + 1];
+
+	iovec * last = extents.compact(iov, begin, end - begin);
+
+	REQUIRE(last - iov == 3);//The left aligned reason joins the following static text
+
+	std::string gathered;
+
+	for(iovec * segment = iov; segment != last; ++segment)
+	  {
+	    gathered.append((const char *)segment->iov_base, segment->iov_len);
+	  }
+
+	REQUIRE(gathered == expected);
+
+	THEN("A handler records its extent as its previous length")
+	  {
+	    string<config::dynamic, align::left, ' ', action::write>(begin + handles[1].offset, "Not Found", 9, handles[1].width, extents.length(1));
+	    REQUIRE(extents.length(1) == 9);
+
+	    extents.reset(begin, 0);
+
+	    REQUIRE(extents.compact(compacted, begin, end - begin) == compacted + extents.compact_size(end - begin));
+	    REQUIRE(std::string(compacted, extents.compact_size(end - begin)) == "HTTP/1.1  Not Found\r\nContent-Length: 1234");
+	  }
+      }
+  }
+}
+
+SCENARIO("HTTP response", "[http]")
+{
+  static_assert(http::max_reason_length() == 31, "Wrong longest reason.");
+  static_assert(http::reason(200)[0] == 'O', "Wrong reason.");
+  static_assert(http::reason(299)[0] == '\0', "Unknown status with a reason.");
+
+  REQUIRE(std::string(http::reason(404)) == "Not Found");
+  REQUIRE(std::string(http::reason(511)) == "Network Authentication Required");
+  REQUIRE(std::string(http::reason(42)) == "");
+
+  const std::string blank_status(3 + 1 + http::max_reason_length(), ' ');
+
+  const auto status = [](const char * text) -> std::string
+    {
+      std::string line(text);
+
+      return line.append(3 + 1 + http::max_reason_length() - line.size(), ' ');
+    };
+
+  FOR("No optional header")
+    {
+      static_assert(!std::is_constructible<http::response_t, http::headers_t>::value, "A temporary configuration would dangle.");
+
+      http::headers_t headers;
+
+      const prototype_t<http::response_t> prototype(http::response_t(headers), 0, 0, 0);
+
+      REQUIRE(std::string(prototype.data(), prototype.size()) == "HTTP/1.1 " + blank_status + "\r\n\r\n");
+    }
+
+  FOR("Standard and custom headers")
+    {
+      const time_t now = 784111777;//Sun, 06 Nov 1994 08:49:37 GMT
+
+      date_clock_t clock;
+
+      http::headers_t headers;
+      headers.clock = &clock;
+      headers.length_digits = 6;
+      headers.content_type = "text/html; charset=UTF-8";
+      headers.connection = "keep-alive";
+      headers.custom.push_back({"Server", "buffer_handle"});
+
+      const prototype_t<http::response_t> prototype(http::response_t(headers), 0, 0, now);
+
+      const std::string tail =
+	"Content-Type: text/html; charset=UTF-8\r\n"
+	"Connection: keep-alive\r\n"
+	"Server: buffer_handle\r\n"
+	"\r\n";
+
+      REQUIRE(std::string(prototype.data(), prototype.size()) ==
+	      "HTTP/1.1 " + blank_status + "\r\n"
+	      "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+	      "Content-Length:       \r\n" + tail);
+
+      GIVEN_A_BUFFER(256)
+	{
+	  http::response_t response(headers);
+
+	  end = prototype.clone(begin, response);
+
+	  THEN("Writes only touch the status, the date and the length")
+	    {
+	      REQUIRE(response.handle<action::write>(begin, 404, 123456, now) == end);
+	      REQUIRE(std::string(begin, end) ==
+		      "HTTP/1.1 " + status("404 Not Found") + "\r\n"
+		      "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+		      "Content-Length: 123456\r\n" + tail);
+
+	      REQUIRE(response.handle<action::write>(begin, 200, 12, now + 3600) == end);
+	      REQUIRE(std::string(begin, end) ==
+		      "HTTP/1.1 " + status("200 OK") + "\r\n"
+		      "Date: Sun, 06 Nov 1994 09:49:37 GMT\r\n"
+		      "Content-Length:     12\r\n" + tail);
+
+	      REQUIRE(response.handle<action::write>(begin, 204, 0, now + 3600) == end);
+	      REQUIRE(std::string(begin, end) ==
+		      "HTTP/1.1 " + status("204 No Content") + "\r\n"
+		      "Date: Sun, 06 Nov 1994 09:49:37 GMT\r\n"
+		      "Content-Length:      0\r\n" + tail);
+
+	      REQUIRE(response.handle<action::reset>(begin, 0, 0, 0) == end);
+	      REQUIRE(std::string(begin, end) ==
+		      "HTTP/1.1 " + blank_status + "\r\n"
+		      "Date:                              \r\n"
+		      "Content-Length:       \r\n" + tail);
+	    }
+	}
+    }
+}
+
+SCENARIO("Helper", "[helper]")
+{
+  static_assert(must_write(config::static_, action::prepare), "");
+  static_assert(write_when_reset(action::reset) == action::write, "");
+
+  const char pad = ' ';
+
+  const char reference[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.";
+  char buffer[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.";
+  const std::size_t max_length = std::strlen(buffer);
+  char * begin = buffer;
+  char * end = buffer + max_length;
+
+  GIVEN("A buffer")
+    {
+      WHEN("Pad left")
+	{
+	  std::size_t previous_length = max_length;
+
+	  WHEN("Use previous length")
+	    {
+	      THEN("Keep all")
+		{
+		  pad_left<true, pad>(begin + max_length, end, max_length, previous_length);
+
+		  REQUIRE(previous_length == max_length);
+		  REQUIRE(std::string(begin, end) == reference);
+		}
+
+	      THEN("Keep all characters but the first 10")
+		{
+		  pad_left<true, pad>(begin, end - 10, max_length, previous_length);
+
+		  REQUIRE(previous_length == 10);
+		  REQUIRE(std::string(begin, end) == (std::string(max_length - 10, pad) + std::string(reference).substr(max_length - 10)));
+		}
+	    }
+
+	  WHEN("Not use previous length")
+	    {
+	      THEN("Keep all characters but the first 10")
+		{
+		  pad_left<false, pad>(begin, end - 10, max_length, previous_length);
+
+		  REQUIRE(std::string(begin, end) == std::string(max_length - 10, pad) + std::string(reference).substr(max_length - 10));
+		}
+	    }
+	}
+
+      WHEN("Pad right")
+	{
+	  std::size_t previous_length = max_length;
+
+	  WHEN("Use previous length")
+	    {
+	      THEN("Keep all")
+		{
+		  pad_right<true, pad>(begin, end, max_length, previous_length);
+
+		  REQUIRE(previous_length == max_length);
+		  REQUIRE(std::string(begin, end) == reference);
+		}
+
+	      THEN("Keep first 10 characters")
+		{
+		  pad_right<true, pad>(begin, begin + 10, max_length, previous_length);
+
+		  REQUIRE(previous_length == 10);
+		  REQUIRE(std::string(begin, end) == std::string(reference).substr(0, 10) + std::string(max_length - 10, pad));
+		}
+	    }
+
+	  WHEN("Not use previous length")
+	    {
+	      THEN("Keep first 10 characters")
+		{
+		  pad_right<false, pad>(begin, begin + 10, max_length, previous_length);
+
+		  REQUIRE(std::string(begin, end) == std::string(reference).substr(0, 10) + std::string(max_length - 10, pad));
+		}
+	    }
+	}
+    }
+}
+
+SCENARIO("Itoa adapter", "[itoa, adapter]")
+{
+  WHEN("To string")
+    {
+      adapter::itoa::to_string_t to_string;
+
+      GIVEN_A_BUFFER(64)
+	{
+	  WHEN("Forward")
+	    {
+
+#define TEST(I, L)						\
+	      THEN(#I)						\
+		{						\
+		  end = to_string.fwd(begin, I);		\
+								\
+		  REQUIRE(std::size_t(end - begin) == L);			\
+		  REQUIRE(std::string(begin, end) == #I);	\
+		}
+
+	      TEST(0, 1);
+	      TEST(1, 1);
+	      TEST(10, 2);
+	      TEST(99, 2);
+	      TEST(3993, 4);
+
+#undef TEST
+	    }
+
+	  WHEN("Backward")
+	    {
+#define TEST(I, L)						\
+	      THEN(#I)						\
+		{						\
+		  begin = to_string.bwd(end, I);		\
+								\
+		  REQUIRE(std::size_t(end - begin) == L);			\
+		  REQUIRE(std::string(begin, end) == #I);	\
+		}
+
+	      TEST(0, 1);
+	      TEST(1, 1);
+	      TEST(10, 2);
+	      TEST(99, 2);
+	      TEST(3993, 4);
+
+#undef TEST
+	    }
+	}
+    }
+}
+
+struct http_version_t
+{
+  static constexpr const char * value()
+  {
+    return "HTTP/1.1 ";
+  }
+};
+
+SCENARIO("Layout", "[layout]")
+{
+  typedef layout_t<text_field_t<http_version_t>,
+		   digits_field_t<3, unsigned>,
+		   characters_field_t<' '>,
+		   string_field_t<10>,
+		   characters_field_t<'\r', '\n'>,
+		   integral_field_t<6, align::right, ' ', adapter::itoa::to_string_t, std::size_t>> status_line_t;
+
+  static_assert(status_line_t::size == 9 + 3 + 1 + 10 + 2 + 6, "Wrong layout size.");
+  static_assert(status_line_t::offset<1>() == 9, "Wrong field offset.");
+  static_assert(status_line_t::offset<3>() == 13, "Wrong field offset.");
+  static_assert(status_line_t::offset<5>() == 25, "Wrong field offset.");
+
+  GIVEN_A_BUFFER(32)
+  {
+    end = status_line_t::handle<action::size>(nullptr);
+    REQUIRE((std::size_t)end == status_line_t::size);
+
+    end = status_line_t::handle<action::prepare>(begin);
+    REQUIRE(std::string(begin, end) == "HTTP/1.1 000           \r\n      ");
+
+    THEN("Every dynamic field is written at once")
+      {
+	end = status_line_t::write(begin, 200u, "OK", (std::size_t)1234);
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 OK        \r\n  1234");
+
+	THEN("A single field can be rewritten")
+	  {
+	    end = status_line_t::write<3>(begin, "Not Found");
+	    REQUIRE(std::string(begin, end) == "HTTP/1.1 200 Not Found \r\n  1234");
+
+	    end = status_line_t::write<1>(begin, 404u);
+	    REQUIRE(std::string(begin, end) == "HTTP/1.1 404 Not Found \r\n  1234");
+	  }
+
+	THEN("The dynamic fields can be reset")
+	  {
+	    end = status_line_t::handle<action::reset>(begin);
+	    REQUIRE(std::string(begin, end) == "HTTP/1.1 000           \r\n      ");
+	  }
+      }
+  }
+
+  FOR("Static fields in a shared image and dynamic fields in a compact buffer")
+    {
+      static_assert(status_line_t::image_size == 9 + 1 + 2, "Wrong image size.");
+      static_assert(status_line_t::dynamic_size == 3 + 10 + 6, "Wrong dynamic size.");
+      static_assert(status_line_t::segments == 6, "Wrong segment count.");
+      static_assert(status_line_t::split_offset<2>() == 9, "Wrong split offset.");
+      static_assert(status_line_t::split_offset<5>() == 13, "Wrong split offset.");
+
+      typedef layout_t<characters_field_t<'<'>,
+		       characters_field_t<'['>,
+		       digits_field_t<2>,
+		       digits_field_t<2>,
+		       characters_field_t<']'>> merged_t;
+
+      static_assert(merged_t::segments == 3, "Adjacent fields of the same kind are not merged.");
+
+      char image[status_line_t::image_size];
+
+      REQUIRE(status_line_t::handle_image<action::prepare>(image) == image + status_line_t::image_size);
+      REQUIRE(std::string(image, status_line_t::image_size) == "HTTP/1.1  \r\n");
+
+      GIVEN_A_BUFFER(status_line_t::dynamic_size)
+      {
+	end = status_line_t::handle_dynamic<action::prepare>(begin);
+	REQUIRE(std::string(begin, end) == "000                ");
+
+	end = status_line_t::write_dynamic(begin, 200u, "OK", (std::size_t)1234);
+	REQUIRE(std::string(begin, end) == "200OK          1234");
+
+	end = status_line_t::write_dynamic<3>(begin, "Not Found");
+	REQUIRE(std::string(begin, end) == "200Not Found   1234");
+
+	iovec iov[status_line_t::segments];
+
+	REQUIRE(status_line_t::gather(iov, image, begin) == iov + status_line_t::segments);
+
+	std::string gathered;
+
+	for(const iovec & segment : iov)
+	  {
+	    gathered.append((const char *)segment.iov_base, segment.iov_len);
+	  }
+
+	REQUIRE(gathered == "HTTP/1.1 200 Not Found \r\n  1234");
+	REQUIRE(iov[0].iov_base == image);
+	REQUIRE(iov[1].iov_base == begin);
+
+	end = status_line_t::handle_dynamic<action::reset>(begin);
+	REQUIRE(std::string(begin, end) == "000                ");
+      }
+    }
+}
+
+SCENARIO("Nothing", "[nothing]")
+{
+  char c;
+
+  REQUIRE(((std::size_t)nothing_t().handle<action::size>(nullptr) == 0));
+  REQUIRE(nothing_t().handle<action::prepare>(&c) == &c);
+  REQUIRE(nothing_t().handle<action::write>(&c) == &c);
+  REQUIRE(nothing_t().handle<action::reset>(&c) == &c);
+}
+
+SCENARIO("Number", "[number]")
+{
+  {
+    REQUIRE(details::digits<uint8_t>(0) == 1);
+    REQUIRE(details::digits<uint8_t>(1) == 1);
+    REQUIRE(details::digits<uint8_t>(4) == 1);
+    REQUIRE(details::digits<uint8_t>(67) == 2);
+    REQUIRE(details::digits<uint8_t>(234) == 3);
+
+    REQUIRE(details::digits<int>(-1) == 2);
+    REQUIRE(details::digits<int>(-4) == 2);
+    REQUIRE(details::digits<int>(-34) == 3);
+  }
+
+  const char pad = ' ';
+
+  FOR("Two digits numbers")
+    {
+      FOR("A static or a dynamic configuration")
+	{
+	  FOR("A leading zero")
+	    {
+	      FIRST("Get the size")
+		{
+		  REQUIRE(((std::size_t)two_digits_number<config::static_, '\0', action::size, uint8_t>(nullptr, 0) == 2));
+
+		  GIVEN_A_BUFFER(2)
+		    {
+		      THEN("Prepare")
+			{
+			  end = two_digits_number<config::static_, '\0', action::prepare, uint8_t>(begin, 43);
+
+			  REQUIRE(std::size_t(end - begin) == 2);
+			  REQUIRE(std::string(begin, end) == "43");
+			}
+
+		      THEN("Prepare")
+			{
+			  end = two_digits_number<config::static_, '\0', action::prepare, uint8_t>(begin, 7);
+
+			  REQUIRE(std::size_t(end - begin) == 2);
+			  REQUIRE(std::string(begin, end) == "07");
+			}
+
+		      THEN("Prepare")
+			{
+			  end = two_digits_number<config::static_, '\0', action::prepare, uint8_t>(begin, 0);
+
+			  REQUIRE(std::size_t(end - begin) == 2);
+			  REQUIRE(std::string(begin, end) == "00");
+			}
+		    }
+		}
+	    }
+
+	  FOR("A leading space")
+	    {
+	      FIRST("Get the Size")
+		{
+		  REQUIRE(((std::size_t)two_digits_number<config::static_, pad, action::size, uint8_t>(nullptr, 0) == 2));
+		  GIVEN_A_BUFFER(2)
+		    {
+		      THEN("Prepare")
+			{
+			  end = two_digits_number<config::static_, pad, action::prepare, uint8_t>(begin, 99);
+
+			  REQUIRE(std::size_t(end - begin) == 2);
+			  REQUIRE(std::string(begin, end) == "99");
+			}
+
+		      THEN("Prepare")
+			{
+			  end = two_digits_number<config::static_, pad, action::prepare, uint8_t>(begin, 7);
+
+			  REQUIRE(std::size_t(end - begin) == 2);
+			  REQUIRE(std::string(begin, end) == " 7");
+			}
+
+		      THEN("Prepare")
+			{
+			  end = two_digits_number<config::static_, pad, action::prepare, uint8_t>(begin, 0);
+
+			  REQUIRE(std::size_t(end - begin) == 2);
+			  REQUIRE(std::string(begin, end) == " 0");
+			}
+		    }
+		}
+	    }
+	}
+    }
+
+  FOR("Four digits numbers")
+    {
+      FOR("A static or a dynamic configuration")
+	{
+	  FIRST("Get the size")
+	    {
+	      REQUIRE(((std::size_t)four_digits_number<config::static_, action::size, uint16_t>(nullptr, 0) == 4));
+	      GIVEN_A_BUFFER(4)
+		{
+		  THEN("Prepare")
+		    {
+		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 0);
+
+		      REQUIRE(std::size_t(end - begin) == 4);
+		      REQUIRE(std::string(begin, end) == "0000");
+		    }
+
+		  THEN("Prepare")
+		    {
+		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 2);
+
+		      REQUIRE(std::size_t(end - begin) == 4);
+		      REQUIRE(std::string(begin, end) == "0002");
+		    }
+
+		  THEN("Prepare")
+		    {
+		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 56);
+
+		      REQUIRE(std::size_t(end - begin) == 4);
+		      REQUIRE(std::string(begin, end) == "0056");
+		    }
+
+		  THEN("Prepare")
+		    {
+		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 723);
+
+		      REQUIRE(std::size_t(end - begin) == 4);
+		      REQUIRE(std::string(begin, end) == "0723");
+		    }
+
+		  THEN("Prepare")
+		    {
+		      end = four_digits_number<config::static_, action::prepare, uint16_t>(begin, 2968);
+
+		      REQUIRE(std::size_t(end - begin) == 4);
+		      REQUIRE(std::string(begin, end) == "2968");
+		    }
+		}
+	    }
+	}
+    }
+
+  FOR("N digits numbers")
+    {
+      FOR("A static or a dynamic configuration")
+	{
+	  FIRST("Get the size")
+	    {
+	      REQUIRE(((std::size_t)digits_number<config::static_, 6, action::size, uint32_t>(nullptr, 0) == 6));
+
+	      GIVEN_A_BUFFER(9)
+		{
+		  THEN("Prepare")
+		    {
+		      end = digits_number<config::static_, 6, action::prepare, uint32_t>(begin, 1234);
+
+		      REQUIRE(std::size_t(end - begin) == 6);
+		      REQUIRE(std::string(begin, end) == "001234");
+		    }
+
+		  THEN("Write")
+		    {
+		      end = digits_number<config::dynamic, 9, action::write, long>(begin, 999999999);
+
+		      REQUIRE(std::size_t(end - begin) == 9);
+		      REQUIRE(std::string(begin, end) == "999999999");
+
+		      end = digits_number<config::static_, 9, action::write, long>(begin, 0);
+
+		      REQUIRE(std::size_t(end - begin) == 9);
+		      REQUIRE(std::string(begin, end) == "999999999");
+		    }
+		}
+	    }
+	}
+    }
+
+  FOR("An integral number")
+    {
+      const char pad = ' ';
+      uint8_t max_digits = 0;
+
+      adapter::itoa::to_string_t itoa;
+
+      FOR("A static configuration")
+	{
+	  WHEN("Left or right aligned, any padding")
+	    {
+	      FIRST("Get the size")
+		{
+		  const std::size_t size = (std::size_t)integral_number<config::static_, align::left, pad, action::size>(nullptr, 1998, max_digits, itoa);
+
+		  GIVEN_A_BUFFER(size)
+		  {
+		    THEN("Prepare")
+		      {
+			end = integral_number<config::static_, align::left, pad, action::prepare>(begin, 1998, max_digits, itoa);
+
+			REQUIRE(end == begin + 4);
+			REQUIRE(max_digits == 4);
+			REQUIRE(std::string(begin, end) == "1998");
+		      }
+		  }
+		}
+	    }
+	}
+
+      FOR("A dynamic configuration")
+	{
+	  uint8_t previous_digits = 0;
+	  const uint8_t max_digits_ = 8;
+
+	  WHEN("Left-aligned")
+	    {
+	      FIRST("Get the size")
+		{
+		  const std::size_t size = (std::size_t)integral_number<config::dynamic, align::left, pad, action::size>(nullptr, 19237840, max_digits, previous_digits, itoa);
+
+		  REQUIRE(size == max_digits_);
+		  REQUIRE(previous_digits == 0);
+
+		  GIVEN_A_BUFFER(size)
+		  {
+		    THEN("Prepare")
+		      {
+			end = integral_number<config::dynamic, align::left, pad, action::prepare>(begin, 19237840, max_digits, previous_digits, itoa);
+
+			REQUIRE(std::size_t(end - begin) == max_digits_);
+			REQUIRE(max_digits == max_digits_);
+			REQUIRE(previous_digits == 0);
+			REQUIRE(std::string(begin, end) == "        ");
+
+			THEN("Write")
+			  {
+			    end = integral_number<config::dynamic, align::left, pad, action::write>(begin, 1923784, max_digits, previous_digits, itoa);
+
+			    REQUIRE(std::size_t(end - begin) == max_digits_);
+			    REQUIRE(max_digits == max_digits_);
+			    REQUIRE(previous_digits == 7);
+			    REQUIRE(std::string(begin, end) == "1923784 ");
+
+			    THEN("Reset")
+			      {
+				end = integral_number<config::dynamic, align::left, pad, action::reset>(begin, 19, max_digits, previous_digits, itoa);
+
+				REQUIRE(std::size_t(end - begin) == max_digits_);
+				REQUIRE(max_digits == max_digits_);
+				REQUIRE(previous_digits == 0);
+				REQUIRE(std::string(begin, end) == std::string(max_digits_, pad));
+
+				THEN("Write")
+				  {
+				    end = integral_number<config::dynamic, align::left, pad, action::write>(begin, 7326, max_digits, previous_digits, itoa);
+
+				    REQUIRE(std::size_t(end - begin) == max_digits_);
+				    REQUIRE(max_digits == max_digits_);
+				    REQUIRE(previous_digits == 4);
+				    REQUIRE(std::string(begin, end) == "7326" + std::string(max_digits_ - 4, pad));
+				  }
+			      }
+			  }
+		      }
+		  }
+		}
+	    }
+
+	  WHEN("Right-aligned")
+	    {
+	      FIRST("Get the size")
+		{
+		  const std::size_t size = (std::size_t)integral_number<config::dynamic, align::right, pad, action::size>(nullptr, 19237840, max_digits, previous_digits, itoa);
+
+		  REQUIRE(size == max_digits_);
+		  REQUIRE(previous_digits == 0);
+
+		  GIVEN_A_BUFFER(size)
+		  {
+		    THEN("Prepare")
+		      {
+			end = integral_number<config::dynamic, align::right, pad, action::prepare>(begin, 19237840, max_digits, previous_digits, itoa);
+
+			REQUIRE(std::size_t(end - begin) == max_digits_);
+			REQUIRE(max_digits == max_digits_);
+			REQUIRE(previous_digits == 0);
+			REQUIRE(std::string(begin, end) == "        ");
+
+			THEN("Write")
+			  {
+			    end = integral_number<config::dynamic, align::right, pad, action::write>(begin, 1923784, max_digits, previous_digits, itoa);
+
+			    REQUIRE(std::size_t(end - begin) == max_digits_);
+			    REQUIRE(max_digits == max_digits_);
+			    REQUIRE(previous_digits == 7);
+			    REQUIRE(std::string(begin, end) == " 1923784");
+
+			    THEN("Reset")
+			      {
+				end = integral_number<config::dynamic, align::right, pad, action::reset>(begin, 19, max_digits, previous_digits, itoa);
+
+				REQUIRE(std::size_t(end - begin) == max_digits_);
+				REQUIRE(max_digits == max_digits_);
+				REQUIRE(previous_digits == 0);
+				REQUIRE(std::string(begin, end) == std::string(max_digits_, pad));
+
+				THEN("Write")
+				  {
+				    end = integral_number<config::dynamic, align::right, pad, action::write>(begin, 7236, max_digits, previous_digits, itoa);
+
+				    REQUIRE(std::size_t(end - begin) == max_digits_);
+				    REQUIRE(max_digits == max_digits_);
+				    REQUIRE(previous_digits == 4);
+				    REQUIRE(std::string(begin, end) == std::string(max_digits_ - 4, pad) + "7236");
+				  }
+			      }
+			  }
+		      }
+		  }
+		}
+	    }
+	}
+    }
+
+  adapter::itoa::to_string_t itoa;
+
+  FOR("integral_number_t<config::static_>")
+    {
+      typedef integral_number_t<config::static_, align::left, ' ', uint8_t> number_type;
+
+      number_type number = number_type();
+
+      const std::size_t size = (std::size_t)number.handle<action::size>(nullptr, 11, itoa);
+
+      REQUIRE(size == 2);
+    }
+
+  FOR("integral_number_t<config::dynamic>")
+    {
+      typedef integral_number_t<config::dynamic, align::left, ' ', uint8_t> number_type;
+
+      number_type number = number_type();
+
+      const std::size_t size = (std::size_t)number.handle<action::size>(nullptr, 183, itoa);
+
+      REQUIRE(size == 3);
+    }
+
+  FOR("integral_number_t<config::dynamic, ..., true>")
+    {
       typedef integral_number_t<config::dynamic, align::left, ' ', uint64_t, uint8_t, true> number_type;
 
-      number_type number = number_type();
+      number_type number = number_type();
+
+      const std::size_t size = (std::size_t)number.handle<action::size>(nullptr, 34378367, itoa);
+
+      REQUIRE(size == 8);
+    }
+}
+
+struct set_t
+{
+  enum class value_type {None, Alice = 1, Bob = 2, Charlie = 4, David = 8};
+  static const std::size_t count = 4;
+  static const char * get(value_type value)
+  {
+    switch(value)
+      {//LCOV_EXCL_START
+      case value_type::Alice: return "Alice";
+      case value_type::Bob: return "Bob";
+      case value_type::Charlie: return "Charlie";
+      case value_type::David: return "David";
+      default: return "";
+	//LCOV_EXCL_STOP
+      }
+  }
+};
+
+set_t::value_type operator | (set_t::value_type lhs, set_t::value_type rhs)
+{
+  return (set_t::value_type)
+    (((typename std::underlying_type<set_t::value_type>::type)lhs)
+     | ((typename std::underlying_type<set_t::value_type>::type)rhs));
+}
+
+struct wide_set_t
+{
+  typedef uint16_t value_type;
+  static const std::size_t count = 10;
+  static const char * get(value_type value)
+  {
+    static const char * names[] = {"b0", "b1", "b2", "b3", "b4", "b5", "b6", "b7", "b8", "b9"};
+
+    std::size_t bit = 0;
+
+    while(value >>= 1) ++bit;
+
+    return names[bit];
+  }
+};
+
+struct sparse_set_t
+{
+  typedef uint64_t value_type;
+  static const std::size_t count = 64;
+  static const char * get(value_type value)
+  {
+    static char names[64][4];
+
+    std::size_t bit = 0;
+
+    while(value >>= 1) ++bit;
+
+    std::snprintf(names[bit], sizeof(names[bit]), "b%zu", bit);
+
+    return names[bit];
+  }
+};
+
+struct stateful_separator_t
+{
+  char value;
+
+  template<config Config, action Action>
+  char * handle(char * buffer) const
+  {
+    return character<Config, Action>(buffer, this->value);
+  }
+};
+
+SCENARIO("SWAR", "[swar]")
+{
+  GIVEN_A_BUFFER(32)
+  {
+    THEN("Every two and four digits value is zero padded")
+      {
+	for(uint32_t i = 0; i < 10000; ++i)
+	  {
+	    const std::string expected = std::to_string(10000 + i).substr(1);
+
+	    if(i < 100)
+	      {
+		end = swar::write_2_digits(begin, i);
+		REQUIRE(std::string(begin, end) == expected.substr(2));
+	      }
+
+	    end = swar::write_4_digits(begin, i);
+	    REQUIRE(std::string(begin, end) == expected);
+	  }
+      }
+
+    THEN("Six, eight and sixteen digits values are zero padded")
+      {
+	for(uint64_t i = 1; i < 10000000000000000; i = i * 7 + 3)
+	  {
+	    const std::string expected = std::to_string(10000000000000000 + i).substr(1);
+
+	    if(i < 1000000)
+	      {
+		end = swar::write_6_digits(begin, i);
+		REQUIRE(std::string(begin, end) == expected.substr(10));
+	      }
+
+	    if(i < 100000000)
+	      {
+		end = swar::write_8_digits(begin, i);
+		REQUIRE(std::string(begin, end) == expected.substr(8));
+	      }
+
+	    end = swar::write_16_digits(begin, i);
+	    REQUIRE(std::string(begin, end) == expected);
+
+	    end = swar::write_digits<19>(begin, i);
+	    REQUIRE(std::string(begin, end) == "000" + expected);
+
+	    end = swar::write_digits<5>(begin, i % 100000);
+	    REQUIRE(std::string(begin, end) == expected.substr(11));
+	  }
+      }
+
+    THEN("The time is written at once")
+      {
+	for(uint32_t hours = 0; hours < 24; ++hours)
+	  {
+	    for(uint32_t minutes = 0; minutes < 60; ++minutes)
+	      {
+		for(uint32_t seconds = 0; seconds < 60; seconds += 7)
+		  {
+		    end = swar::write_time(begin, hours, minutes, seconds);
+		    REQUIRE(std::string(begin, end) == std::to_string(100 + hours).substr(1) + ":" + std::to_string(100 + minutes).substr(1) + ":" + std::to_string(100 + seconds).substr(1));
+		  }
+	      }
+	  }
+      }
+
+    THEN("Digits are parsed back")
+      {
+	uint32_t value, hours, minutes, seconds;
+
+	for(uint32_t i = 0; i < 100000000; i = i * 3 + 7)
+	  {
+	    swar::write_8_digits(begin, i);
+	    REQUIRE(swar::parse_8_digits(begin, value));
+	    REQUIRE(value == i);
+
+	    REQUIRE(swar::parse_4_digits(begin + 4, value));
+	    REQUIRE(value == i % 10000);
+
+	    REQUIRE(swar::parse_2_digits(begin + 6, value));
+	    REQUIRE(value == i % 100);
+	  }
+
+	REQUIRE(swar::parse_time("23:59:07", hours, minutes, seconds));
+	REQUIRE(hours == 23);
+	REQUIRE(minutes == 59);
+	REQUIRE(seconds == 7);
+
+	REQUIRE_FALSE(swar::parse_2_digits("1:", value));
+	REQUIRE_FALSE(swar::parse_2_digits("/0", value));
+	REQUIRE_FALSE(swar::parse_4_digits("12 4", value));
+	REQUIRE_FALSE(swar::parse_8_digits("1234567A", value));
+	REQUIRE_FALSE(swar::parse_time("23-59-07", hours, minutes, seconds));
+	REQUIRE_FALSE(swar::parse_time("23:5?:07", hours, minutes, seconds));
+      }
+  }
+}
+
+struct response_handler_t
+{
+  string_t<config::dynamic, align::left, ' '> reason;
+  integral_number_t<config::dynamic, align::right, ' ', std::size_t> length;
+
+  template<action Action>
+  char * handle(char * buffer, const char * reason, std::size_t length)
+  {
+    buffer = string<config::static_, Action>(buffer, "HTTP/1.1 200 ");
+    buffer = this->reason.handle<Action>(buffer, reason, std::strlen(reason));
+    buffer = string<config::static_, Action>(buffer, "\r\nContent-Length: ");
+    buffer = this->length.handle<Action, adapter::itoa::to_string_t>(buffer, length);
+
+    return buffer;
+  }
+};
+
+SCENARIO("Prototype", "[prototype]")
+{
+  const prototype_t<response_handler_t> prototype(response_handler_t(), "Not Found", 999999);
+
+  REQUIRE(prototype.size() == 13 + 9 + 18 + 6);
+  REQUIRE(std::string(prototype.data(), prototype.size()) == "HTTP/1.1 200          \r\nContent-Length:       ");
+
+  GIVEN_A_BUFFER(64)
+  {
+    response_handler_t handler;
+
+    end = prototype.clone(begin, handler);
+    REQUIRE(std::size_t(end - begin) == prototype.size());
+
+    THEN("The clone is written like a prepared buffer")
+      {
+	handler.handle<action::write>(begin, "OK", 1234);
+	REQUIRE(std::string(begin, end) == "HTTP/1.1 200 OK       \r\nContent-Length:   1234");
+
+	char * expected = (char *)alloca(prototype.size());
+	response_handler_t other;
+
+	other.handle<action::prepare>(expected, "Not Found", 999999);
+	other.handle<action::write>(expected, "OK", 1234);
+	REQUIRE(std::string(begin, end) == std::string(expected, prototype.size()));
+
+	THEN("The prototype is left untouched")
+	  {
+	    REQUIRE(std::string(prototype.data(), prototype.size()) == "HTTP/1.1 200          \r\nContent-Length:       ");
+	  }
+      }
+  }
+}
+
+SCENARIO("Pool", "[pool]")
+{
+  const prototype_t<response_handler_t> prototype(response_handler_t(), "Not Found", 999999);
+
+  const std::string pristine(prototype.data(), prototype.size());
+
+  FOR("A single thread")
+    {
+      pool_t<response_handler_t> pool(prototype, 4);
+
+      REQUIRE(pool.capacity() == 4);
+
+      pool_t<response_handler_t>::entry_t * entries[5];
+
+      for(std::size_t i = 0; i < 5; ++i)
+	{
+	  entries[i] = pool.acquire();
+	}
+
+      REQUIRE(entries[4] == nullptr);
+
+      for(std::size_t i = 0; i < 4; ++i)
+	{
+	  REQUIRE(entries[i] != nullptr);
+	  REQUIRE((uintptr_t)entries[i] % 64 == 0);
+	  REQUIRE((uintptr_t)entries[i]->buffer % 64 == 0);
+	  REQUIRE(std::string(entries[i]->buffer, prototype.size()) == pristine);
+
+	  entries[i]->handler.handle<action::write>(entries[i]->buffer, "OK", i);
+	}
+
+      THEN("Released entries are cloned again")
+	{
+	  pool.release(entries[2]);
+
+	  pool_t<response_handler_t>::entry_t * entry = pool.acquire();
+
+	  REQUIRE(entry == entries[2]);
+	  REQUIRE(std::string(entry->buffer, prototype.size()) == pristine);
+	}
+
+      THEN("A cache refills from and flushes to the pool")
+	{
+	  for(std::size_t i = 0; i < 4; ++i)
+	    {
+	      pool.release(entries[i]);
+	    }
+
+	  {
+	    pool_cache_t<response_handler_t, 2> cache(pool);
+
+	    entries[0] = cache.acquire();
+	    entries[1] = cache.acquire();
+	    entries[2] = cache.acquire();
+
+	    REQUIRE(entries[0] != nullptr);
+	    REQUIRE(entries[1] != nullptr);
+	    REQUIRE(entries[2] != nullptr);
+	    REQUIRE(pool.acquire() != nullptr);
+	    REQUIRE(cache.acquire() == nullptr);
+
+	    cache.release(entries[0]);
+	    cache.release(entries[1]);
+	    cache.release(entries[2]);
+
+	    REQUIRE(pool.acquire() == entries[1]);
+	    REQUIRE(pool.acquire() == nullptr);
+	  }
+
+	  REQUIRE(pool.acquire() != nullptr);
+	  REQUIRE(pool.acquire() != nullptr);
+	  REQUIRE(pool.acquire() == nullptr);
+	}
+    }
+
+  FOR("Concurrent threads")
+    {
+      pool_t<response_handler_t> pool(prototype, 64);
+
+      std::atomic<std::size_t> errors(0);
+      std::vector<std::thread> threads;
+
+      for(std::size_t t = 0; t < 8; ++t)
+	{
+	  threads.emplace_back([&pool, &pristine, &errors, t]()
+			       {
+				 pool_cache_t<response_handler_t, 4> cache(pool);
+
+				 for(std::size_t i = 0; i < 20000; ++i)
+				   {
+				     pool_t<response_handler_t>::entry_t * entry = cache.acquire();
+
+				     if(entry == nullptr)
+				       {
+					 continue;
+				       }
+
+				     if(std::string(entry->buffer, pristine.size()) != pristine)
+				       {
+					 ++errors;
+				       }
+
+				     const std::size_t value = t * 100000 + i % 1000;
+
+				     char * end = entry->handler.handle<action::write>(entry->buffer, "OK", value);
+
+				     if(std::string(end - 6, end) != std::to_string(value).insert(0, 6 - std::to_string(value).size(), ' '))
+				       {
+					 ++errors;
+				       }
+
+				     cache.release(entry);
+				   }
+			       });
+	}
+
+      for(std::thread & thread : threads)
+	{
+	  thread.join();
+	}
+
+      THEN("Entries are never shared nor dirty")
+	{
+	  REQUIRE(errors == 0);
+
+	  std::size_t count = 0;
+
+	  while(pool.acquire() != nullptr)
+	    {
+	      ++count;
+	    }
+
+	  REQUIRE(count == 64);
+	}
+    }
+}
+
+SCENARIO("Published", "[published]")
+{
+  prototype_t<response_handler_t> prototype(response_handler_t(), "Not Found", 999999);
+
+  GIVEN_A_BUFFER(64)
+    {
+      response_handler_t handler;
+
+      end = prototype.clone(begin, handler);
+
+      published_t published(begin, prototype.size());
+
+      REQUIRE(published.size() == prototype.size());
+
+      FOR("A single thread")
+	{
+	  char * written = published.write(handler, "OK", 2);
+
+	  REQUIRE(written == end);
+
+	  char copy[64];
+
+	  THEN("A reader copies the last written content")
+	    {
+	      REQUIRE(published.read(copy) == copy + prototype.size());
+	      REQUIRE(std::string(copy, prototype.size()) == "HTTP/1.1 200 OK       \r\nContent-Length:      2");
+	    }
+
+	  THEN("The buffer can be written in place between begin and end")
+	    {
+	      char * buffer = published.begin_write();
+
+	      handler.handle<action::write>(buffer, "Not Found", 9);
+
+	      published.end_write();
+
+	      published.read(copy);
+
+	      REQUIRE(std::string(copy, prototype.size()) == "HTTP/1.1 200 Not Found\r\nContent-Length:      9");
+	    }
+	}
+
+      FOR("Concurrent readers")
+	{
+	  const std::string ok = "HTTP/1.1 200 OK       \r\nContent-Length:      2";
+	  const std::string not_found = "HTTP/1.1 200 Not Found\r\nContent-Length:      9";
+
+	  published.write(handler, "OK", 2);
+
+	  std::atomic<bool> done(false);
+	  std::atomic<std::size_t> errors(0);
+	  std::vector<std::thread> readers;
+
+	  for(std::size_t t = 0; t < 4; ++t)
+	    {
+	      readers.emplace_back([&published, &done, &errors, &ok, &not_found]()
+				   {
+				     char copy[64];
+
+				     do
+				       {
+					 published.read(copy);
+
+					 const std::string text(copy, published.size());
+
+					 if(text != ok && text != not_found)
+					   {
+					     ++errors;
+					   }
+				       }
+				     while(!done);
+				   });
+	    }
+
+	  for(std::size_t i = 0; i < 100000; ++i)
+	    {
+	      if(i % 2)
+		{
+		  published.write(handler, "Not Found", 9);
+		}
+	      else
+		{
+		  published.write(handler, "OK", 2);
+		}
+	    }
+
+	  done = true;
+
+	  for(std::thread & reader : readers)
+	    {
+	      reader.join();
+	    }
+
+	  THEN("Readers never see a torn content")
+	    {
+	      REQUIRE(errors == 0);
+	    }
+	}
+    }
+}
+
+SCENARIO("Mapped file", "[mapped_file]")
+{
+  const char * path = "/tmp/buffer_handle-mapped_file.test";
+
+  const auto content = [path]() -> std::string
+    {
+      std::ifstream file(path, std::ios::in | std::ios::binary);
+
+      return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    };
+
+  FOR("A file that cannot be created")
+    {
+      mapped_file_t file;
+
+      REQUIRE_FALSE(file.open("/nonexistent/directory/file", 16));
+      REQUIRE_FALSE(file.is_open());
+    }
+
+  FOR("A template prepared into a file")
+    {
+      response_handler_t handler;
+
+      {
+	mapped_file_t file(2);
+
+	REQUIRE(file.open(path, handler, "Not Found", 999999));
+	REQUIRE(file.is_open());
+	REQUIRE(file.size() == 46);
+	REQUIRE(content() == "HTTP/1.1 200          \r\nContent-Length:       ");
+
+	THEN("Actions are applied in place and the file length never changes")
+	  {
+	    REQUIRE(file.handle<action::write>(handler, "OK", 2) == file.data() + file.size());
+	    REQUIRE(content() == "HTTP/1.1 200 OK       \r\nContent-Length:      2");
+
+	    file.handle<action::write>(handler, "Not Found", 123456);
+	    REQUIRE(content() == "HTTP/1.1 200 Not Found\r\nContent-Length: 123456");
+
+	    file.handle<action::reset>(handler, "", 0);
+	    REQUIRE(content() == "HTTP/1.1 200          \r\nContent-Length:       ");
+
+	    REQUIRE(file.sync(true));
+	  }
+      }
+
+      std::remove(path);
+    }
+}
+
+#ifdef __linux__
+SCENARIO("io_uring sink", "[uring_sink]")
+{
+  const prototype_t<response_handler_t> prototype(response_handler_t(), "Not Found", 999999);
+
+  pool_t<response_handler_t> pool(prototype, 4);
+  uring_sink_t<response_handler_t> sink(pool);
+
+  if(!sink.open(8))
+    {
+      WARN("io_uring is not available");
+
+      return;
+    }
+
+  REQUIRE(sink.is_open());
+
+  FOR("A local file")
+    {
+      const char * path = "/tmp/buffer_handle-uring_sink.test";
+
+      const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      REQUIRE(fd != -1);
+
+      std::string expected;
+
+      for(std::size_t i = 0; i < 20; ++i)
+	{
+	  pool_t<response_handler_t>::entry_t * entry = pool.acquire();
+
+	  if(entry == nullptr)//Every buffer is in flight
+	    {
+	      REQUIRE(sink.submit(true));
+
+	      entry = pool.acquire();
+	    }
+
+	  REQUIRE(entry != nullptr);
+
+	  char * end = entry->handler.handle<action::write>(entry->buffer, i % 2 ? "OK" : "Not Found", i);
+
+	  expected.append(entry->buffer, end);
+
+	  REQUIRE(sink.write(fd, entry, end - entry->buffer));
+	}
+
+      REQUIRE(sink.drain());
+      REQUIRE(sink.errors() == 0);
+
+      ::close(fd);
+
+      THEN("Records are written in order and buffers are recycled")
+	{
+	  std::ifstream file(path, std::ios::in | std::ios::binary);
+
+	  REQUIRE(std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()) == expected);
+
+	  pool_t<response_handler_t>::entry_t * entries[5];
+
+	  REQUIRE(pool.acquire(entries, entries + 5) == entries + 4);
+	  REQUIRE(std::string(entries[0]->buffer, prototype.size()) == std::string(prototype.data(), prototype.size()));
+	}
+
+      std::remove(path);
+    }
+
+  FOR("Writes queued when closing")
+    {
+      const int fd = ::open("/dev/null", O_WRONLY);
+      REQUIRE(fd != -1);
+
+      for(std::size_t i = 0; i < 3; ++i)
+	{
+	  pool_t<response_handler_t>::entry_t * entry = pool.acquire();
+	  REQUIRE(entry != nullptr);
+
+	  REQUIRE(sink.write(fd, entry, prototype.size()));
+	}
+
+      sink.close();
+
+      ::close(fd);
+
+      THEN("Every buffer is back in the pool")
+	{
+	  REQUIRE(!sink.is_open());
+
+	  pool_t<response_handler_t>::entry_t * entries[5];
 
-      const std::size_t size = (std::size_t)number.handle<action::size>(nullptr, 34378367, itoa);
+	  REQUIRE(pool.acquire(entries, entries + 5) == entries + 4);
+	}
+    }
 
-      REQUIRE(size == 8);
+  FOR("A pipe")
+    {
+      int fds[2];
+      REQUIRE(::pipe(fds) == 0);
+
+      const char prefix[] = "<14>";
+
+      iovec iov[3][2];
+
+      for(std::size_t i = 0; i < 3; ++i)
+	{
+	  pool_t<response_handler_t>::entry_t * entry = pool.acquire();
+	  REQUIRE(entry != nullptr);
+
+	  char * end = entry->handler.handle<action::write>(entry->buffer, "OK", 200 + i);
+
+	  iov[i][0].iov_base = (void *)prefix;
+	  iov[i][0].iov_len = 4;
+	  iov[i][1].iov_base = entry->buffer;
+	  iov[i][1].iov_len = end - entry->buffer;
+
+	  REQUIRE(sink.writev(fds[1], entry, iov[i], 2));
+	}
+
+      REQUIRE(sink.submit());
+      REQUIRE(sink.drain());
+      REQUIRE(sink.errors() == 0);
+
+      ::close(fds[1]);
+
+      std::string received;
+      char chunk[256];
+
+      for(ssize_t n; (n = ::read(fds[0], chunk, sizeof(chunk))) > 0;)
+	{
+	  received.append(chunk, n);
+	}
+
+      ::close(fds[0]);
+
+      THEN("Scattered records are gathered in order")
+	{
+	  REQUIRE(received ==
+		  "<14>HTTP/1.1 200 OK       \r\nContent-Length:    200"
+		  "<14>HTTP/1.1 200 OK       \r\nContent-Length:    201"
+		  "<14>HTTP/1.1 200 OK       \r\nContent-Length:    202");
+	}
+    }
+
+  FOR("An invalid descriptor")
+    {
+      pool_t<response_handler_t>::entry_t * entry = pool.acquire();
+
+      REQUIRE(sink.write(-1, entry, prototype.size()));
+      REQUIRE(sink.drain());
+
+      THEN("The failure is counted and the buffer recycled")
+	{
+	  REQUIRE(sink.errors() == 1);
+
+	  pool_t<response_handler_t>::entry_t * entries[5];
+
+	  REQUIRE(pool.acquire(entries, entries + 5) == entries + 4);
+	}
     }
 }
+#endif
 
-struct set_t
+struct log_record_handler_t
 {
-  enum class value_type {None, Alice = 1, Bob = 2, Charlie = 4, David = 8};
-  static const std::size_t count = 4;
-  static const char * get(value_type value)
+  integral_number_t<config::dynamic, align::right, ' ', uint64_t> time;
+  enumeration_t<config::dynamic, align::left, ' ', level_enumeration_t> level;
+  integral_number_t<config::dynamic, align::right, ' ', std::size_t> thread;
+  string_t<config::dynamic, align::left, ' '> message;
+
+  template<action Action>
+  char * handle(char * buffer, uint64_t time, level_t level, std::size_t thread, const char * message)
   {
-    switch(value)
-      {//LCOV_EXCL_START
-      case value_type::Alice: return "Alice";
-      case value_type::Bob: return "Bob";
-      case value_type::Charlie: return "Charlie";
-      case value_type::David: return "David";
-      default: return "";
-	//LCOV_EXCL_STOP
-      }
+    buffer = this->time.handle<Action, adapter::itoa::to_string_t>(buffer, time);
+    buffer = space<config::static_, Action>(buffer);
+    buffer = this->level.handle<Action>(buffer, level);
+    buffer = space<config::static_, Action>(buffer);
+    buffer = this->thread.handle<Action, adapter::itoa::to_string_t>(buffer, thread);
+    buffer = space<config::static_, Action>(buffer);
+    buffer = this->message.handle<Action>(buffer, message, std::strlen(message));
+    buffer = character<config::static_, Action>(buffer, '\n');
+
+    return buffer;
   }
 };
 
-set_t::value_type operator | (set_t::value_type lhs, set_t::value_type rhs)
-{
-  return (set_t::value_type)
-    (((typename std::underlying_type<set_t::value_type>::type)lhs)
-     | ((typename std::underlying_type<set_t::value_type>::type)rhs));
-}
+SCENARIO("Ring logger", "[ring_logger]")
+{
+  const prototype_t<log_record_handler_t> prototype(log_record_handler_t(), 999999, level_t::debug, 99, "0123456789");
+
+  REQUIRE(prototype.size() == 6 + 1 + 7 + 1 + 2 + 1 + 10 + 1);
+
+  FOR("A single producer flushed by hand")
+    {
+      int fds[2];
+      REQUIRE(::pipe(fds) == 0);
+
+      ring_logger_t<log_record_handler_t> logger(prototype, 4, fds[1]);
+
+      REQUIRE(logger.capacity() == 4);
+      REQUIRE(logger.flush() == 0);
+
+      REQUIRE(logger.log(1, level_t::info, 1, "Starting"));
+      REQUIRE(logger.log(2, level_t::warning, 1, "Low memory"));
+      REQUIRE(logger.log(3, level_t::error, 1, "Crashed"));
+
+      REQUIRE(logger.flush() == 3);
+
+      THEN("Records are written in order and slots are reused across the end of the ring")
+	{
+	  REQUIRE(logger.log(4, level_t::debug, 2, "A"));
+	  REQUIRE(logger.log(5, level_t::debug, 2, "B"));
+
+	  ring_logger_t<log_record_handler_t>::slot_t * slot = logger.claim();
+	  REQUIRE(slot != nullptr);
+	  slot->handler.handle<action::write>(slot->buffer, 6, level_t::info, 2, "C");
+
+	  REQUIRE(logger.log(7, level_t::debug, 2, "D"));
+	  REQUIRE_FALSE(logger.log(8, level_t::debug, 2, "Full"));
+
+	  REQUIRE(logger.flush() == 2);//Stops at the slot not committed yet
+
+	  logger.commit(slot);
+
+	  REQUIRE(logger.flush() == 2);
+	  REQUIRE(logger.errors() == 0);
+
+	  ::close(fds[1]);
+
+	  std::string received;
+	  char chunk[256];
+
+	  for(ssize_t n; (n = ::read(fds[0], chunk, sizeof(chunk))) > 0;)
+	    {
+	      received.append(chunk, n);
+	    }
+
+	  REQUIRE(received ==
+		  "     1 INFO     1 Starting  \n"
+		  "     2 WARNING  1 Low memory\n"
+		  "     3 ERROR    1 Crashed   \n"
+		  "     4 DEBUG    2 A         \n"
+		  "     5 DEBUG    2 B         \n"
+		  "     6 INFO     2 C         \n"
+		  "     7 DEBUG    2 D         \n");
+	}
+
+      ::close(fds[0]);
+    }
+
+  FOR("Multiple producers and a flushing thread")
+    {
+      const char * path = "/tmp/buffer_handle-ring_logger.test";
+
+      const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      REQUIRE(fd != -1);
+
+      const std::size_t producers = 4;
+      const std::size_t records = 2000;
+
+      {
+	ring_logger_t<log_record_handler_t, true> logger(prototype, 64, fd);
+
+	logger.start(std::chrono::microseconds(10));
+
+	std::vector<std::thread> threads;
+
+	for(std::size_t t = 0; t < producers; ++t)
+	  {
+	    threads.emplace_back([&logger, t]()
+				 {
+				   for(std::size_t i = 0; i < records;)
+				     {
+				       if(logger.log(i, (level_t)(i % 4), t, "message"))
+					 {
+					   ++i;
+					 }
+				       else
+					 {
+					   std::this_thread::yield();
+					 }
+				     }
+				 });
+	  }
+
+	for(std::thread & thread : threads)
+	  {
+	    thread.join();
+	  }
+
+	logger.stop();
+
+	REQUIRE(logger.errors() == 0);
+      }
+
+      ::close(fd);
+
+      THEN("Every record is written whole and in order per producer")
+	{
+	  std::ifstream file(path, std::ios::in | std::ios::binary);
+	  const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	  REQUIRE(content.size() == producers * records * prototype.size());
+
+	  std::vector<std::size_t> next(producers, 0);
+	  std::size_t errors = 0;
+
+	  for(std::size_t offset = 0; offset < content.size(); offset += prototype.size())
+	    {
+	      const std::string record = content.substr(offset, prototype.size());
+
+	      const std::size_t i = std::stoul(record.substr(0, 6));
+	      const std::size_t t = std::stoul(record.substr(15, 2));
+
+	      if(t >= producers || i != next[t]++ || record.substr(18) != "message   \n" || record.substr(7, 7).find(level_enumeration_t::get((level_t)(i % 4))) != 0)
+		{
+		  ++errors;
+		}
+	    }
+
+	  REQUIRE(errors == 0);
+	}
+
+      std::remove(path);
+    }
+}
+
+SCENARIO("Syslog", "[syslog]")
+{
+  FOR("A priority")
+    {
+      GIVEN_A_BUFFER(5)
+      {
+	REQUIRE((std::size_t)priority<config::dynamic, action::size>(nullptr, facility::kern, severity::emergency) == 5);
+
+	end = priority<config::dynamic, action::prepare>(begin, facility::kern, severity::emergency);
+	REQUIRE(std::string(begin, end) == "  <0>");
+	REQUIRE(priority_offset(facility::kern, severity::emergency) == 2);
+
+	end = priority<config::dynamic, action::write>(begin, facility::user, severity::notice);
+	REQUIRE(std::string(begin, end) == " <13>");
+	REQUIRE(priority_offset(facility::user, severity::notice) == 1);
+
+	end = priority<config::dynamic, action::write>(begin, facility::local7, severity::debug);
+	REQUIRE(std::string(begin, end) == "<191>");
+	REQUIRE(priority_offset(facility::local7, severity::debug) == 0);
+      }
+    }
+
+  FOR("An RFC 5424 header")
+    {
+      rfc5424::header_t<config::dynamic, precision::milliseconds> header("host.example.com", "app");
+
+      timespec time;
+      time.tv_sec = 784111777;
+      time.tv_nsec = 3000000;
+
+      const std::size_t size = (std::size_t)header.handle<action::size>(nullptr, facility::user, severity::error, time, nullptr, nullptr);
+
+      REQUIRE(size == 5 + 2 + 24 + 1 + 16 + 1 + 3 + 1 + 128 + 1 + 32);
+
+      auto tokens = [](const char * begin, const char * end)
+	{
+	  std::vector<std::string> fields(1);
+
+	  for(; begin != end; ++begin)
+	    {
+	      if(*begin == ' ')
+		{
+		  fields.emplace_back();
+		}
+	      else
+		{
+		  fields.back() += *begin;
+		}
+	    }
+
+	  return fields;
+	};
+
+      GIVEN_A_BUFFER(size)
+      {
+	end = header.handle<action::prepare>(begin, facility::user, severity::error, time, nullptr, nullptr);
+	REQUIRE(end == begin + size);
+	REQUIRE(std::string(header.begin(begin), end) == "<11>1 1994-11-06T08:49:37.003Z host.example.com app - -");
+
+	THEN("Write")
+	  {
+	    time.tv_sec += 60;
+
+	    end = header.handle<action::write>(begin, facility::local0, severity::warning, time, "1234", "ID47");
+	    REQUIRE(end == begin + size);
+	    REQUIRE(std::string(header.begin(begin), end) == "<132>1 1994-11-06T08:50:37.003Z host.example.com app 1234 ID47");
+
+	    const std::vector<std::string> fields = tokens(header.begin(begin), end);
+
+	    REQUIRE(fields.size() == 6);
+	    REQUIRE(fields[0] == "<132>1");
+	    REQUIRE(fields[1] == "1994-11-06T08:50:37.003Z");
+	    REQUIRE(fields[2] == "host.example.com");
+	    REQUIRE(fields[3] == "app");
+	    REQUIRE(fields[4] == "1234");
+	    REQUIRE(fields[5] == "ID47");
+
+	    time.tv_sec += 1;
+
+	    end = header.handle<action::write>(begin, facility::local0, severity::warning, time, "5678", "ID48");
+	    REQUIRE(end == begin + size);
+	    REQUIRE(std::string(header.begin(begin), end) == "<132>1 1994-11-06T08:50:38.003Z host.example.com app 5678 ID48");
+
+	    end = header.handle<action::write>(begin, facility::kern, severity::alert, time, "", "X");
+	    REQUIRE(end == begin + size);
+	    REQUIRE(std::string(header.begin(begin), end) == "<1>1 1994-11-06T08:50:38.003Z host.example.com app - X");
+	    REQUIRE(tokens(header.begin(begin), end).size() == 6);
+
+	    end = header.handle<action::reset>(begin, facility::kern, severity::alert, time, "1234", "ID47");
+	    REQUIRE(end == begin + size);
+	    REQUIRE(std::string(end - 4, end) == " - -");
+	  }
+      }
+    }
+
+  FOR("An RFC 3164 header")
+    {
+      rfc3164::header_t<config::dynamic> header("mymachine", "su[12]");
+
+      const std::size_t size = (std::size_t)header.handle<action::size>(nullptr, facility::auth, severity::critical, 0);
+
+      REQUIRE(size == 5 + 15 + 1 + 9 + 1 + 6 + 2);
+
+      GIVEN_A_BUFFER(size)
+      {
+	end = header.handle<action::prepare>(begin, facility::auth, severity::critical, 784111777);
+	REQUIRE(std::string(header.begin(begin), end) == "<34>Nov  6 08:49:37 mymachine su[12]: ");
+
+	THEN("Write")
+	  {
+	    end = header.handle<action::write>(begin, facility::kern, severity::debug, 784111777 + 86400 * 10);
+	    REQUIRE(std::string(header.begin(begin), end) == "<7>Nov 16 08:49:37 mymachine su[12]: ");
+	  }
+      }
+    }
+
+  FOR("A static header")
+    {
+      rfc3164::header_t<config::static_> header("mymachine", "su");
+
+      GIVEN_A_BUFFER(64)
+      {
+	end = header.handle<action::prepare>(begin, facility::auth, severity::critical, 784111777);
+	end = header.handle<action::write>(begin, facility::kern, severity::debug, 0);
+	REQUIRE(std::string(header.begin(begin), end) == "<34>Nov  6 08:49:37 mymachine su: ");
+      }
+    }
+}
+
+SCENARIO("Bitset", "[bitset]")
+{
+  character_separator_t<','> separator;
+
+  FOR("A static configuration")
+    {
+      const std::size_t size = (std::size_t)bitset<set_t, action::size>(nullptr, set_t::value_type::Alice | set_t::value_type::Bob, separator);
+
+      GIVEN_A_BUFFER(size)
+      {
+	THEN("Prepare")
+	  {
+	    end = bitset<set_t, action::prepare>(begin, set_t::value_type::Alice | set_t::value_type::Bob, separator);
+
+	    REQUIRE(std::size_t(end - begin) == size);
+	    REQUIRE(std::string(begin, end) == "Alice,Bob");
+	  }
+      }
+    }
+
+  FOR("A dynamic configuration")
+    {
+      std::size_t max_length;
+
+      WHEN("Left-aligned")
+	{
+	  const std::size_t size = (std::size_t)bitset<config::dynamic, align::left, ' ', set_t, action::size>(nullptr, set_t::value_type::Alice | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+
+	  GIVEN_A_BUFFER(size)
+	  {
+	    THEN("Prepare")
+	      {
+		end = bitset<config::dynamic, align::left, ' ', set_t, action::prepare>(begin, set_t::value_type::Alice | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+
+		REQUIRE(std::size_t(end - begin) == size);
+		REQUIRE(std::string(begin, end) == std::string(size, ' '));
+
+		THEN("Write")
+		  {
+		    end = bitset<config::dynamic, align::left, ' ', set_t, action::write>(begin, set_t::value_type::Charlie, max_length, separator);
+
+		    REQUIRE(std::size_t(end - begin) == size);
+		    REQUIRE(std::string(begin, end) == std::string("Charlie") + std::string(max_length - std::strlen("Charlie"), ' '));
+		  }
+	      }
+	  }
+	}
+
+      WHEN("Right-aligned")
+	{
+	  const std::size_t size = (std::size_t)bitset<config::dynamic, align::right, ' ', set_t, action::size>(nullptr, set_t::value_type::Alice | set_t::value_type::Bob | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+
+	  GIVEN_A_BUFFER(size)
+	  {
+	    THEN("Prepare")
+	      {
+		end = bitset<config::dynamic, align::right, ' ', set_t, action::prepare>(begin, set_t::value_type::Alice | set_t::value_type::Bob | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+
+		REQUIRE(std::size_t(end - begin) == size);
+		REQUIRE(std::string(begin, end) == std::string(size, ' '));
+
+		THEN("Write")
+		  {
+		    end = bitset<config::dynamic, align::right, ' ', set_t, action::write>(begin, set_t::value_type::Bob | set_t::value_type::Charlie, max_length, separator);
+
+		    REQUIRE(std::size_t(end - begin) == size);
+		    REQUIRE(std::string(begin, end) == std::string(max_length - std::strlen("Bob") - 1 - std::strlen("Charlie"), ' ') + "Bob,Charlie");
+		  }
+	      }
+	  }
+	}
+    }
+  FOR("A set spanning several bytes")
+    {
+      character_separator_t<','> separator;
+
+      const uint16_t value = (1 << 0) | (1 << 7) | (1 << 8) | (1 << 9) | (1 << 12);
+
+      const std::size_t size = (std::size_t)bitset<wide_set_t, action::size>(nullptr, value, separator);
+
+      REQUIRE(size == std::strlen("b0,b7,b8,b9"));
+
+      GIVEN_A_BUFFER(size)
+      {
+	THEN("Prepare")
+	  {
+	    end = bitset<wide_set_t, action::prepare>(begin, value, separator);
+
+	    REQUIRE(std::string(begin, end) == "b0,b7,b8,b9");
+	  }
+
+	THEN("Write right-aligned")
+	  {
+	    std::size_t max_length;
+
+	    bitset<config::dynamic, align::right, ' ', wide_set_t, action::prepare>(begin, value, max_length, separator);
+	    end = bitset<config::dynamic, align::right, ' ', wide_set_t, action::write>(begin, (1 << 7) | (1 << 8), max_length, separator);
+
+	    REQUIRE(std::string(begin, end) == "      b7,b8");
+	  }
+      }
+    }
+
+  FOR("A sparse set")
+    {
+      const uint64_t value = (1ull << 3) | (1ull << 40) | (1ull << 63);
 
-SCENARIO("Bitset", "[bitset]")
-{
-  character_separator_t<','> separator;
+      stateful_separator_t separator = {'|'};
 
-  FOR("A static configuration")
+      WHEN("Left-aligned")
+	{
+	  REQUIRE((std::size_t)bitset<sparse_set_t, action::size>(nullptr, value, separator) == std::strlen("b3|b40|b63"));
+
+	  GIVEN_A_BUFFER(16)
+	  {
+	    end = bitset<sparse_set_t, action::prepare>(begin, value, separator);
+
+	    REQUIRE(std::string(begin, end) == "b3|b40|b63");
+	  }
+	}
+
+      WHEN("Right-aligned")
+	{
+	  std::size_t max_length;
+
+	  REQUIRE((std::size_t)bitset<config::dynamic, align::right, '.', sparse_set_t, action::size>(nullptr, value, max_length, separator) == std::strlen("b3|b40|b63"));
+
+	  GIVEN_A_BUFFER(16)
+	  {
+	    bitset<config::dynamic, align::right, '.', sparse_set_t, action::prepare>(begin, value, max_length, separator);
+	    end = bitset<config::dynamic, align::right, '.', sparse_set_t, action::write>(begin, 1ull << 40, max_length, separator);
+
+	    REQUIRE(std::string(begin, end) == ".......b40");
+	  }
+	}
+    }
+
+  FOR("A stateful separator")
     {
-      const std::size_t size = (std::size_t)bitset<set_t, action::size>(nullptr, set_t::value_type::Alice | set_t::value_type::Bob, separator);
+      stateful_separator_t separator = {';'};
+
+      const std::size_t size = (std::size_t)bitset<set_t, action::size>(nullptr, set_t::value_type::Bob | set_t::value_type::David, separator);
 
       GIVEN_A_BUFFER(size)
       {
 	THEN("Prepare")
 	  {
-	    end = bitset<set_t, action::prepare>(begin, set_t::value_type::Alice | set_t::value_type::Bob, separator);
+	    end = bitset<set_t, action::prepare>(begin, set_t::value_type::Bob | set_t::value_type::David, separator);
 
-	    REQUIRE(std::size_t(end - begin) == size);
-	    REQUIRE(std::string(begin, end) == "Alice,Bob");
+	    REQUIRE(std::string(begin, end) == "Bob;David");
+	  }
+
+	THEN("Write right-aligned")
+	  {
+	    std::size_t max_length;
+
+	    bitset<config::dynamic, align::right, ' ', set_t, action::prepare>(begin, set_t::value_type::Bob | set_t::value_type::David, max_length, separator);
+	    end = bitset<config::dynamic, align::right, ' ', set_t, action::write>(begin, set_t::value_type::Alice, max_length, separator);
+
+	    REQUIRE(std::string(begin, end) == "    Alice");
 	  }
       }
     }
+}
 
-  FOR("A dynamic configuration")
+SCENARIO("Table", "[table]")
+{
+  typedef table_t<'|', ' ', '-', column_t<6>, column_t<4, align::right> > report_t;
+
+  static_assert(report_t::row_length == 6 + 1 + 4 + 1, "");
+
+  adapter::itoa::to_string_t itoa;
+
+  FOR("A table with a header")
     {
-      std::size_t max_length;
+      report_t report(2);
 
-      WHEN("Left-aligned")
+      const char * headers[] = {"Name", "Qty"};
+
+      FIRST("Get the size")
 	{
-	  const std::size_t size = (std::size_t)bitset<config::dynamic, align::left, ' ', set_t, action::size>(nullptr, set_t::value_type::Alice | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+	  const std::size_t size = (std::size_t)report.handle<action::size>(nullptr, headers);
+
+	  REQUIRE(size == 4 * report_t::row_length);
 
 	  GIVEN_A_BUFFER(size)
 	  {
 	    THEN("Prepare")
 	      {
-		end = bitset<config::dynamic, align::left, ' ', set_t, action::prepare>(begin, set_t::value_type::Alice | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+		end = report.handle<action::prepare>(begin, headers);
 
 		REQUIRE(std::size_t(end - begin) == size);
-		REQUIRE(std::string(begin, end) == std::string(size, ' '));
+		REQUIRE(std::string(begin, end) ==
+			"Name  | Qty\n"
+			"------|----\n"
+			"      |    \n"
+			"      |    \n");
 
-		THEN("Write")
+		THEN("Write cells")
 		  {
-		    end = bitset<config::dynamic, align::left, ' ', set_t, action::write>(begin, set_t::value_type::Charlie, max_length, separator);
+		    end = report.cell<action::write>(begin, 1, 0, "apple", 5);
 
-		    REQUIRE(std::size_t(end - begin) == size);
-		    REQUIRE(std::string(begin, end) == std::string("Charlie") + std::string(max_length - std::strlen("Charlie"), ' '));
+		    REQUIRE(end == report.cell(begin, 1, 1) - 1);
+
+		    report.cell<action::write>(begin, 1, 1, 42, itoa);
+		    report.cell<action::write>(begin, 0, 1, 7, itoa);
+
+		    REQUIRE(std::string(begin, begin + size) ==
+			    "Name  | Qty\n"
+			    "------|----\n"
+			    "      |   7\n"
+			    "apple |  42\n");
+
+		    THEN("Reset a cell")
+		      {
+			report.cell<action::reset>(begin, 1, 0, nullptr, 0);
+
+			REQUIRE(std::string(report.cell(begin, 1, 0), report.cell(begin, 1, 1)) == "      |");
+		      }
+
+		    THEN("Reset the table")
+		      {
+			report.handle<action::reset>(begin, headers);
+
+			REQUIRE(std::string(begin, begin + size) ==
+				"Name  | Qty\n"
+				"------|----\n"
+				"      |    \n"
+				"      |    \n");
+		      }
 		  }
 	      }
 	  }
 	}
+    }
 
-      WHEN("Right-aligned")
+  FOR("A table without a header")
+    {
+      table_t<' ', '.', '\0', column_t<3, align::right>, column_t<3> > report(1);
+
+      const std::size_t size = (std::size_t)report.handle<action::size>(nullptr, nullptr);
+
+      REQUIRE(size == 8);
+
+      GIVEN_A_BUFFER(size)
+      {
+	THEN("Prepare and write")
+	  {
+	    end = report.handle<action::prepare>(begin, nullptr);
+	    report.cell<action::write>(begin, 0, 0, "ab", 2);
+	    report.cell<action::write>(begin, 0, 1, "cd", 2);
+
+	    REQUIRE(std::string(begin, end) == ".ab cd.\n");
+	  }
+      }
+    }
+}
+
+SCENARIO("Token", "[token]")
+{
+  FOR("A sequence of tokens")
+    {
+      static_assert(tokens_t<'\r', '\n'>::size == 2, "");
+
+      FIRST("Get the size")
 	{
-	  const std::size_t size = (std::size_t)bitset<config::dynamic, align::right, ' ', set_t, action::size>(nullptr, set_t::value_type::Alice | set_t::value_type::Bob | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+	  REQUIRE((std::size_t)tokens<config::dynamic, action::size, '\r', '\n', ',', ' '>(nullptr) == 4);
 
-	  GIVEN_A_BUFFER(size)
+	  GIVEN_A_BUFFER(4)
 	  {
-	    THEN("Prepare")
+	    WHEN("Static")
 	      {
-		end = bitset<config::dynamic, align::right, ' ', set_t, action::prepare>(begin, set_t::value_type::Alice | set_t::value_type::Bob | set_t::value_type::Charlie | set_t::value_type::David, max_length, separator);
+		REQUIRE(tokens<config::static_, action::write, '\r', '\n', ',', ' '>(begin) == begin + 4);
+		REQUIRE(std::string(begin, begin + 4) == std::string(4, '\0'));
 
-		REQUIRE(std::size_t(end - begin) == size);
-		REQUIRE(std::string(begin, end) == std::string(size, ' '));
-
-		THEN("Write")
+		THEN("Prepare")
 		  {
-		    end = bitset<config::dynamic, align::right, ' ', set_t, action::write>(begin, set_t::value_type::Bob | set_t::value_type::Charlie, max_length, separator);
+		    end = tokens<config::static_, action::prepare, '\r', '\n', ',', ' '>(begin);
 
-		    REQUIRE(std::size_t(end - begin) == size);
-		    REQUIRE(std::string(begin, end) == std::string(max_length - std::strlen("Bob") - 1 - std::strlen("Charlie"), ' ') + "Bob,Charlie");
+		    REQUIRE(std::string(begin, end) == "\r\n, ");
 		  }
 	      }
+
+	    WHEN("As a separator")
+	      {
+		tokens_t<';', ' '> separator;
+
+		end = separator.handle<config::dynamic, action::write>(begin);
+
+		REQUIRE(std::string(begin, end) == "; ");
+	      }
 	  }
 	}
     }
@@ -1958,6 +4216,100 @@ SCENARIO("Time", "[time]")
 	  }
 	}
     }
+
+  FOR("timespec")
+    {
+      timespec time;
+      time.tv_sec = 784111777;
+      time.tv_nsec = 4567890;
+
+      FIRST("Get the size")
+	{
+	  REQUIRE((std::size_t)time_<config::dynamic, precision::seconds, action::size>(nullptr, time) == 8);
+	  REQUIRE((std::size_t)time_<config::dynamic, precision::milliseconds, action::size>(nullptr, time) == 12);
+	  REQUIRE((std::size_t)time_<config::dynamic, precision::nanoseconds, action::size>(nullptr, time) == 18);
+
+	  GIVEN_A_BUFFER(18)
+	  {
+	    THEN("Prepare")
+	      {
+		end = time_<config::dynamic, precision::seconds, action::prepare>(begin, time);
+		REQUIRE(std::string(begin, end) == "08:49:37");
+
+		end = time_<config::dynamic, precision::microseconds, action::prepare>(begin, time);
+		REQUIRE(std::string(begin, end) == "08:49:37.004567");
+
+		THEN("Write")
+		  {
+		    begin[2] = '!';
+		    begin[5] = '!';
+		    begin[8] = '!';
+
+		    time.tv_sec += 1;
+		    time.tv_nsec = 999999999;
+
+		    end = time_<config::dynamic, precision::microseconds, action::write>(begin, time);
+		    REQUIRE(std::string(begin, end) == "08!49!38!999999");
+		  }
+	      }
+	  }
+	}
+    }
+
+  FOR("A time point")
+    {
+      const std::chrono::system_clock::time_point time = std::chrono::system_clock::from_time_t(784111777) + std::chrono::microseconds(120034);
+
+      GIVEN_A_BUFFER(15)
+      {
+	end = time_<config::dynamic, precision::milliseconds, action::prepare>(begin, time);
+	REQUIRE(std::string(begin, end) == "08:49:37.120");
+
+	end = time_<config::dynamic, precision::microseconds, action::prepare>(begin, time);
+	REQUIRE(std::string(begin, end) == "08:49:37.120034");
+      }
+    }
+
+  FOR("An epoch")
+    {
+      timespec time;
+      time.tv_sec = 1700000000;
+      time.tv_nsec = 123456789;
+
+      FIRST("Get the size")
+	{
+	  REQUIRE((std::size_t)epoch<config::dynamic, precision::seconds, action::size>(nullptr, time) == 10);
+	  REQUIRE((std::size_t)epoch<config::dynamic, precision::milliseconds, action::size>(nullptr, time) == 13);
+
+	  GIVEN_A_BUFFER(19)
+	  {
+	    THEN("Prepare")
+	      {
+		end = epoch<config::dynamic, precision::seconds, action::prepare>(begin, time);
+		REQUIRE(std::string(begin, end) == "1700000000");
+
+		end = epoch<config::dynamic, precision::milliseconds, action::prepare>(begin, time);
+		REQUIRE(std::string(begin, end) == "1700000000123");
+
+		end = epoch<config::dynamic, precision::nanoseconds, action::prepare>(begin, time);
+		REQUIRE(std::string(begin, end) == "1700000000123456789");
+
+		time.tv_sec = 42;
+
+		end = epoch<config::static_, precision::microseconds, action::prepare>(begin, time);
+		REQUIRE(std::string(begin, end) == "0000000042123456");
+	      }
+
+	    THEN("A time point")
+	      {
+		const std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds> time_point(std::chrono::milliseconds(1700000000042));
+
+		end = epoch<config::dynamic, precision::microseconds, action::write>(begin, time_point);
+		REQUIRE(std::string(begin, end) == "1700000000042000");
+	      }
+	  }
+	}
+    }
 }
 
 SCENARIO("Timezone", "[timezone]")
@@ -2175,6 +4527,46 @@ SCENARIO("Timezone", "[timezone]")
 
       REQUIRE(size == 5);
     }
+
+  FOR("A differential timezone with a separator")
+    {
+      typedef differential_timezone_t<config::dynamic, uint8_t, uint8_t, ':'> differential_timezone_type;
+
+      differential_timezone_type timezone(false, 5, 30);
+
+      const std::size_t size = (std::size_t)timezone.handle<action::size>(nullptr);
+
+      REQUIRE(size == 6);
+
+      GIVEN_A_BUFFER(6)
+	{
+	  end = timezone.handle<action::prepare>(begin);
+
+	  REQUIRE(std::size_t(end - begin) == 6);
+	  REQUIRE(std::string(begin, end) == "-05:30");
+
+	  THEN("Write")
+	    {
+	      begin[3] = '!';
+
+	      timezone.positive = true;
+	      timezone.hours = 14;
+	      timezone.minutes = 0;
+
+	      end = timezone.handle<action::write>(begin);
+
+	      REQUIRE(std::string(begin, end) == "+14!00");
+	    }
+
+	  THEN("Without a separator")
+	    {
+	      end = differential_timezone<config::static_, '\0', action::prepare>(begin, true, 1, 2);
+
+	      REQUIRE(std::size_t(end - begin) == 5);
+	      REQUIRE(std::string(begin, end) == "+0102");
+	    }
+	}
+    }
 }
 
 SCENARIO("String", "[string]")
@@ -2453,3 +4845,197 @@ SCENARIO("String", "[string]")
 	}
     }
 }
+
+SCENARIO("Zoneinfo", "[zoneinfo]")
+{
+  struct tzif_t
+  {
+    static void integer(std::string & data, int64_t value, std::size_t size)
+    {
+      for(std::size_t i = size; i > 0; --i)
+	{
+	  data.push_back((char)(value >> (8 * (i - 1)) & 0xFF));
+	}
+    }
+
+    static std::string make(const char * footer)
+    {
+      std::string data("TZif2", 5);
+      data.append(15 + 24, '\0');//Empty version 1 block
+
+      data.append("TZif2", 5);
+      data.append(15, '\0');
+
+      const int64_t counts[6] = { 0, 0, 0, 1, 2, 8 };
+      for(std::size_t i = 0; i < 6; ++i)
+	{
+	  integer(data, counts[i], 4);
+	}
+
+      integer(data, 0, 8);//Transition
+      data.push_back(1);//to CET
+
+      integer(data, 600, 4);//LMT
+      data.push_back(0);
+      data.push_back(0);
+
+      integer(data, 3600, 4);//CET
+      data.push_back(0);
+      data.push_back(4);
+
+      data.append("LMT\0CET\0", 8);
+
+      data.push_back('\n');
+      data.append(footer);
+      data.push_back('\n');
+
+      return data;
+    }
+  };
+
+  const time_t summer = 1782907200;//2026-07-01T12:00:00Z
+  const time_t spring = 1774746000;//2026-03-29T01:00:00Z
+  const time_t autumn = 1792890000;//2026-10-25T01:00:00Z
+
+  FOR("A TZif file")
+    {
+      zoneinfo_t zoneinfo;
+
+      THEN("UTC is the default")
+	{
+	  const zoneinfo_interval_t interval = zoneinfo.find(summer);
+
+	  REQUIRE(interval.offset == 0);
+	  REQUIRE(std::string(interval.abbreviation) == "UTC");
+	  REQUIRE(zoneinfo.transitions() == 0);
+	}
+
+      THEN("Invalid data is refused")
+	{
+	  REQUIRE_FALSE(zoneinfo.parse("TZif", 4));
+	  REQUIRE_FALSE(zoneinfo.load("/nonexistent/zone"));
+
+	  const std::string data = tzif_t::make("CET-1CEST,M3.5.0");
+
+	  REQUIRE_FALSE(zoneinfo.parse(data.data(), data.size()));
+	  REQUIRE_FALSE(zoneinfo.parse(data.data(), data.size() - 20));
+	  REQUIRE(std::string(zoneinfo.find(summer).abbreviation) == "UTC");
+	}
+
+      THEN("Transitions are extended by the footer rule")
+	{
+	  const std::string data = tzif_t::make("CET-1CEST,M3.5.0,M10.5.0/3");
+
+	  REQUIRE(zoneinfo.parse(data.data(), data.size(), 2030));
+	  REQUIRE(zoneinfo.transitions() == 1 + 2 * (2030 - 1970 + 1));
+
+	  zoneinfo_interval_t interval = zoneinfo.find(-1);
+	  REQUIRE(interval.offset == 600);
+	  REQUIRE(std::string(interval.abbreviation) == "LMT");
+	  REQUIRE(interval.end == 0);
+
+	  interval = zoneinfo.find(0);
+	  REQUIRE(interval.offset == 3600);
+	  REQUIRE(std::string(interval.abbreviation) == "CET");
+
+	  interval = zoneinfo.find(spring - 1);
+	  REQUIRE(std::string(interval.abbreviation) == "CET");
+	  REQUIRE(interval.end == spring);
+
+	  interval = zoneinfo.find(spring);
+	  REQUIRE(interval.offset == 7200);
+	  REQUIRE(interval.is_dst);
+	  REQUIRE(std::string(interval.abbreviation) == "CEST");
+	  REQUIRE(interval.begin == spring);
+	  REQUIRE(interval.end == autumn);
+
+	  interval = zoneinfo.find(autumn);
+	  REQUIRE(interval.offset == 3600);
+	  REQUIRE_FALSE(interval.is_dst);
+
+	  interval = zoneinfo.find(summer + 3 * 365 * 86400);//2029
+	  REQUIRE(std::string(interval.abbreviation) == "CEST");
+	}
+
+      THEN("A southern hemisphere rule")
+	{
+	  const std::string data = tzif_t::make("<+10>-10<+11>,M10.1.0,J91/3");
+
+	  REQUIRE(zoneinfo.parse(data.data(), data.size(), 2030));
+
+	  REQUIRE(std::string(zoneinfo.find(summer).abbreviation) == "+10");
+	  REQUIRE(zoneinfo.find(summer - 180 * 86400).offset == 11 * 3600);
+	}
+
+      THEN("A rule without daylight saving time")
+	{
+	  const std::string data = tzif_t::make("CET-1");
+
+	  REQUIRE(zoneinfo.parse(data.data(), data.size()));
+	  REQUIRE(zoneinfo.transitions() == 1);
+	  REQUIRE(zoneinfo.find(summer).offset == 3600);
+	}
+    }
+
+  FOR("A timezone")
+    {
+      zoneinfo_t zoneinfo;
+
+      const std::string data = tzif_t::make("CET-1CEST,M3.5.0,M10.5.0/3");
+      REQUIRE(zoneinfo.parse(data.data(), data.size()));
+
+      typedef zoneinfo_timezone_t<config::dynamic> timezone_t;
+
+      timezone_t timezone(zoneinfo);
+
+      GIVEN_A_BUFFER(32)
+      {
+	THEN("Render a local date")
+	  {
+	    const time_t local = timezone.set(summer);
+
+	    REQUIRE(local == summer + 7200);
+	    REQUIRE(timezone.interval().end == autumn);
+
+	    end = rfc1123::date<config::dynamic, true, true, timezone_t, action::prepare>(begin, local, timezone);
+	    REQUIRE(std::string(begin, end) == "Wed, 01 Jul 2026 14:00:00 +0200");
+
+	    end = rfc1123::date<config::dynamic, true, true, timezone_t, action::write>(begin, timezone.set(autumn), timezone);
+	    REQUIRE(std::string(begin, end) == "Sun, 25 Oct 2026 02:00:00 +0100");
+	  }
+
+	THEN("Render an RFC 3339 offset")
+	  {
+	    zoneinfo_timezone_t<config::dynamic, ':'> offset(zoneinfo);
+
+	    end = rfc3339::date<config::dynamic, precision::seconds, zoneinfo_timezone_t<config::dynamic, ':'>, action::prepare>(begin, offset.set(spring), offset);
+	    REQUIRE(std::string(begin, end) == "2026-03-29T03:00:00+02:00");
+	  }
+
+	THEN("A reload is picked up by the next set")
+	  {
+	    REQUIRE(timezone.set(summer) == summer + 7200);
+	    REQUIRE(zoneinfo.revision() == 1);
+
+	    const std::string other = tzif_t::make("EST5EDT,M3.2.0,M11.1.0");
+	    REQUIRE(zoneinfo.parse(other.data(), other.size()));
+	    REQUIRE(zoneinfo.revision() == 2);
+
+	    REQUIRE(timezone.set(summer) == summer - 4 * 3600);
+	    REQUIRE(std::string(timezone.interval().abbreviation) == "EDT");
+	  }
+      }
+    }
+
+  FOR("The system database")
+    {
+      zoneinfo_t zoneinfo;
+
+      if(zoneinfo.load("Europe/Paris"))
+	{
+	  REQUIRE(std::string(zoneinfo.find(784111777).abbreviation) == "CET");
+	  REQUIRE(std::string(zoneinfo.find(summer).abbreviation) == "CEST");
+	  REQUIRE(zoneinfo.find(summer + 60 * 365 * 86400).offset == 7200);
+	}
+    }
+}
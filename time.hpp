@@ -1,12 +1,14 @@
 #ifndef BUFFER_HANDLE_TIME_HPP
 #define BUFFER_HANDLE_TIME_HPP
 
-#include <ctime> // time_t tm
+#include <chrono> // system_clock time_point
+#include <ctime> // time_t timespec tm
 #include <cstdint> // uint8_t
 
 #include <buffer_handle/action.hpp> // action
 #include <buffer_handle/align.hpp> // align
 #include <buffer_handle/config.hpp> // config
+#include <buffer_handle/precision.hpp> // precision
 
 namespace buffer_handle
 {
@@ -20,7 +22,28 @@ namespace buffer_handle
   char * time_(char * buffer, Hours hours, Minutes minutes, Seconds seconds);
 
   template<config Config, action Action>
-  char * time_(char * buffer, std::tm time);
+  char * time_(char * buffer, const std::tm & time);
+
+  template<config Config, action Action>
+  char * time_(char * buffer, time_t time);
+
+  template<config Config, action Action, class Duration>
+  char * time_(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & time);
+
+  template<config Config, precision Precision, action Action, typename Fraction>
+  char * fractional_seconds(char * buffer, Fraction fraction);
+
+  template<config Config, precision Precision, action Action>
+  char * time_(char * buffer, const timespec & time);
+
+  template<config Config, precision Precision, action Action, class Duration>
+  char * time_(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & time);
+
+  template<config Config, precision Precision, action Action>
+  char * epoch(char * buffer, const timespec & time);
+
+  template<config Config, precision Precision, action Action, class Duration>
+  char * epoch(char * buffer, const std::chrono::time_point<std::chrono::system_clock, Duration> & time);
 };
 
 #include <buffer_handle/time.hcp>
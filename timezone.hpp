@@ -87,7 +87,10 @@ namespace buffer_handle
   template<config Config, action Action, typename Hours, typename Minutes>
   char * differential_timezone(char * buffer, bool sign, Hours hours, Minutes minutes);
 
-  template<config Config, typename Hours, typename Minutes>
+  template<config Config, char Separator, action Action, typename Hours, typename Minutes>
+  char * differential_timezone(char * buffer, bool sign, Hours hours, Minutes minutes);
+
+  template<config Config, typename Hours, typename Minutes, char Separator = '\0'>
   struct differential_timezone_t
   {
   public:
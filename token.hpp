@@ -1,6 +1,8 @@
 #ifndef BUFFER_HANDLE_TOKEN_HPP
 #define BUFFER_HANDLE_TOKEN_HPP
 
+#include <cstddef> // size_t
+
 #include <buffer_handle/action.hpp> // action
 #include <buffer_handle/config.hpp> // config
 
@@ -89,6 +91,18 @@ namespace buffer_handle
 
   template<config Config, action Action>
   char * closing_brace(char * buffer);
+
+  template<config Config, action Action, char... Tokens>
+  char * tokens(char * buffer);
+
+  template<char... Tokens>
+  struct tokens_t
+  {
+    static constexpr std::size_t size = sizeof...(Tokens);
+
+    template<config Config, action Action>
+    char * handle(char * buffer) const;
+  };
 };
 
 #include <buffer_handle/token.hcp>
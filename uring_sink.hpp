@@ -0,0 +1,84 @@
+#ifndef BUFFER_HANDLE_URING_SINK_HPP
+#define BUFFER_HANDLE_URING_SINK_HPP
+
+#ifdef __linux__
+
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t uint64_t
+#include <vector> // vector
+
+#include <linux/io_uring.h> // io_uring_cqe io_uring_sqe
+#include <sys/uio.h> // iovec
+
+#include <buffer_handle/pool.hpp> // pool_entry_t pool_t
+
+namespace buffer_handle
+{
+  template<class Handler>
+  class uring_sink_t
+  {
+  public:
+    typedef pool_entry_t<Handler> entry_t;
+
+  public:
+    uring_sink_t(pool_t<Handler> & pool);
+    ~uring_sink_t();
+
+    uring_sink_t(const uring_sink_t &) = delete;
+    uring_sink_t & operator=(const uring_sink_t &) = delete;
+
+  protected:
+    pool_t<Handler> & pool;
+
+    int ring;
+
+    void * sq_ring;
+    std::size_t sq_ring_size;
+    uint32_t * sq_head;
+    uint32_t * sq_tail;
+    uint32_t * sq_array;
+    uint32_t sq_mask;
+    uint32_t sq_entries;
+
+    io_uring_sqe * sqes;
+    std::size_t sqes_size;
+
+    void * cq_ring;
+    std::size_t cq_ring_size;
+    uint32_t * cq_head;
+    uint32_t * cq_tail;
+    io_uring_cqe * cqes;
+    uint32_t cq_mask;
+
+    std::vector<uint32_t> lengths;//Expected length of the write of each entry
+    io_uring_sqe * last;//Last queued submission, linked to the next one on the same file
+    int last_fd;
+    uint32_t queued;
+    uint32_t in_flight;
+    std::size_t failures;
+
+  public:
+    bool open(unsigned entries);
+    void close();
+
+    bool is_open() const;
+
+    bool write(int fd, entry_t * entry, std::size_t length, uint64_t offset = (uint64_t)-1);
+    bool writev(int fd, entry_t * entry, const iovec * iov, unsigned count, uint64_t offset = (uint64_t)-1);
+
+    bool submit(bool wait = false);
+    std::size_t reap();
+    bool drain();
+
+    std::size_t errors() const;
+
+  protected:
+    io_uring_sqe * queue(int fd, entry_t * entry, std::size_t length);
+  };
+};
+
+#include <buffer_handle/uring_sink.hcp>
+
+#endif/*__linux__*/
+
+#endif/*BUFFER_HANDLE_URING_SINK_HPP*/
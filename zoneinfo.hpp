@@ -0,0 +1,82 @@
+#ifndef BUFFER_HANDLE_ZONEINFO_HPP
+#define BUFFER_HANDLE_ZONEINFO_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // int32_t int64_t uint8_t
+#include <ctime> // time_t
+#include <string> // string
+#include <vector> // vector
+
+#include <buffer_handle/action.hpp> // action
+#include <buffer_handle/config.hpp> // config
+
+namespace buffer_handle
+{
+  struct zoneinfo_interval_t
+  {
+    time_t begin;
+    time_t end;
+    int32_t offset;
+    bool is_dst;
+    const char * abbreviation;
+  };
+
+  class zoneinfo_t
+  {
+  public:
+    zoneinfo_t();
+
+  public:
+    bool load(const char * name, int until_year = 2100);
+    bool parse(const char * data, std::size_t length, int until_year = 2100);
+
+    zoneinfo_interval_t find(time_t value) const;
+
+    std::size_t transitions() const;
+
+    std::size_t revision() const;//Incremented by every successful load
+
+  protected:
+    struct type_t
+    {
+      int32_t offset;
+      bool is_dst;
+      uint8_t abbreviation;
+    };
+
+    std::vector<int64_t> times;
+    std::vector<uint8_t> indexes;
+    std::vector<type_t> types;
+    std::string abbreviations;
+    std::size_t revisions;
+
+  protected:
+    uint8_t type(int32_t offset, bool is_dst, const std::string & abbreviation);
+    bool extend(const char * rule, int until_year);
+  };
+
+  template<config Config, char Separator = '\0'>
+  class zoneinfo_timezone_t
+  {
+  public:
+    zoneinfo_timezone_t(const zoneinfo_t & zoneinfo);
+
+  public:
+    time_t set(time_t value);
+
+    const zoneinfo_interval_t & interval() const;
+
+  protected:
+    const zoneinfo_t & zoneinfo;
+    zoneinfo_interval_t current;
+    std::size_t revision;//Of the zoneinfo_t the interval was found in
+
+  public:
+    template<action Action>
+    char * handle(char * buffer) const;
+  };
+};
+
+#include <buffer_handle/zoneinfo.hcp>
+
+#endif/*BUFFER_HANDLE_ZONEINFO_HPP*/